@@ -0,0 +1,37 @@
+# Runs the instrumented engine on its own workloads and moves the profile 
+# data to where the optimized build looks for it. 
+# 
+# Usage: cmake -DEXE=<instrumented engine> -DGEN_DIR=<instrumented objects> 
+#              -DUSE_DIR=<optimized objects> -DSTAMP=<output file> -P PgoTrain.cmake 
+# 
+# GCC writes one .gcda file next to each instrumented object, so the files 
+# are copied to the same relative paths under the optimized target. 
+
+file(GLOB_RECURSE OLD_PROFILES ${GEN_DIR}/*.gcda)
+if(OLD_PROFILES)
+    file(REMOVE ${OLD_PROFILES})
+endif()
+
+# search covers eval, move ordering and the hash table, perft covers movegen 
+foreach(WORKLOAD "bench;7" "go;perft;5")
+    message(STATUS "PGO training: ${WORKLOAD}")
+    execute_process(
+        COMMAND ${EXE} ${WORKLOAD}
+        RESULT_VARIABLE RESULT
+        OUTPUT_QUIET
+    )
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "PGO training failed: ${WORKLOAD}")
+    endif()
+endforeach()
+
+file(GLOB_RECURSE PROFILES RELATIVE ${GEN_DIR} ${GEN_DIR}/*.gcda)
+if(NOT PROFILES)
+    message(FATAL_ERROR "PGO training did not write any profile data")
+endif()
+foreach(PROFILE ${PROFILES})
+    get_filename_component(PROFILE_DIR ${USE_DIR}/${PROFILE} DIRECTORY)
+    file(COPY ${GEN_DIR}/${PROFILE} DESTINATION ${PROFILE_DIR})
+endforeach()
+
+file(TOUCH ${STAMP})
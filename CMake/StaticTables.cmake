@@ -0,0 +1,56 @@
+# Reports the static data (mostly lookup tables) of an executable. 
+# 
+# Usage: cmake -DNM=<nm> -DEXE=<executable> -P StaticTables.cmake 
+# 
+# Symbols that only differ by a number (such as the per-square magic tables) 
+# are grouped together. Groups smaller than 1 KiB are only counted in the 
+# total. 
+
+execute_process(
+    COMMAND ${NM} --print-size --size-sort --radix=d ${EXE}
+    OUTPUT_VARIABLE SYMBOLS
+    RESULT_VARIABLE RESULT
+    ERROR_QUIET
+)
+if(NOT RESULT EQUAL 0)
+    message(STATUS "Static tables: could not read symbols of ${EXE}")
+    return()
+endif()
+
+string(REPLACE "\n" ";" SYMBOLS "${SYMBOLS}")
+
+set(TOTAL 0)
+set(GROUPS "")
+foreach(SYMBOL ${SYMBOLS})
+    # <address> <size> <type> <name>, only keep data symbols 
+    if(SYMBOL MATCHES "^[0-9]+ 0*([0-9]+) [rRdDbB] ([A-Za-z_][A-Za-z0-9_.]*)$")
+        set(SIZE ${CMAKE_MATCH_1})
+        string(REGEX REPLACE "[0-9]+" "N" GROUP "${CMAKE_MATCH_2}")
+        math(EXPR TOTAL "${TOTAL} + ${SIZE}")
+        if(DEFINED SIZE_${GROUP})
+            math(EXPR SIZE_${GROUP} "${SIZE_${GROUP}} + ${SIZE}")
+        else()
+            set(SIZE_${GROUP} ${SIZE})
+            list(APPEND GROUPS ${GROUP})
+        endif()
+    endif()
+endforeach()
+
+# pad sizes so that sorting the strings sorts by size 
+set(LINES "")
+foreach(GROUP ${GROUPS})
+    if(SIZE_${GROUP} GREATER_EQUAL 1024)
+        string(LENGTH "${SIZE_${GROUP}}" LEN)
+        math(EXPR PAD "10 - ${LEN}")
+        string(REPEAT " " ${PAD} SPACES)
+        list(APPEND LINES "${SPACES}${SIZE_${GROUP}} ${GROUP}")
+    endif()
+endforeach()
+list(SORT LINES)
+list(REVERSE LINES)
+
+math(EXPR TOTAL_KIB "${TOTAL} / 1024")
+message(STATUS "Static tables: ${TOTAL} bytes (${TOTAL_KIB} KiB)")
+foreach(LINE ${LINES})
+    message(STATUS "  ${LINE}")
+endforeach()
@@ -0,0 +1,40 @@
+/**
+ * @file Bench.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Defines the search benchmark. 
+ * 
+ * The benchmark searches a fixed set of positions to a fixed depth with a 
+ * fresh transposition table for each position. With one thread the total 
+ * node count only changes when search behavior changes, so it can be used 
+ * as a signature for a build. 
+ */
+
+#pragma once 
+
+/**
+ * Default search depth for each position. 
+ */
+#define DefaultBenchDepth 9 
+
+/**
+ * Default hash table size in MiB. 
+ */
+#define DefaultBenchHash 16 
+
+/**
+ * Default number of search threads. 
+ */
+#define DefaultBenchThreads 1 
+
+/**
+ * Searches every benchmark position and prints total nodes, time, and speed. 
+ * 
+ * @param depth Search depth for each position 
+ * @param hashMb Hash table size in MiB 
+ * @param numThreads Number of search threads 
+ */
+void RunBench(int depth, int hashMb, int numThreads); 
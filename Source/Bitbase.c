@@ -0,0 +1,235 @@
+/**
+ * @file Bitbase.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Implements endgame bitbases. 
+ */
+
+#include "Bitbase.h" 
+
+#include <stdio.h> 
+#include <stdlib.h> 
+
+#include "Bitboard.h" 
+#include "Types.h" 
+
+/**
+ * Number of KPK positions: side to move, pawn on files a-d and ranks 2-7, 
+ * and both king squares. Positions with the pawn on files e-h are mirrored. 
+ */
+#define KPKSize (2 * 24 * 64 * 64) 
+
+/**
+ * Results of a position during generation, combined as bit flags. 
+ */
+#define ResultInvalid 0 
+#define ResultUnknown 1 
+#define ResultDraw 2 
+#define ResultWin 4 
+
+static U32 KPKBits[KPKSize / 32]; 
+
+static bool IsBitbaseInit = false; 
+
+/**
+ * Gets the index of a KPK position with white as the color with the pawn. 
+ * 
+ * @param turn Color to move 
+ * @param wk White king square 
+ * @param bk Black king square 
+ * @param pawn Pawn square (on files a-d) 
+ * @return The index 
+ */
+static inline int KPKIndex(Color turn, Square wk, Square bk, Square pawn) 
+{
+    return wk | bk << 6 | turn << 12 | GetFile(pawn) << 13 | (6 - GetRank(pawn)) << 15; 
+}
+
+/**
+ * Gets the result of a position from the positions it moves to. The side 
+ * to move picks its best move. 
+ * 
+ * @param db Results of all positions 
+ * @param turn Color to move 
+ * @param wk White king square 
+ * @param bk Black king square 
+ * @param pawn Pawn square 
+ * @return Result of the position 
+ */
+static U8 ClassifyKPK(const U8* db, Color turn, Square wk, Square bk, Square pawn) 
+{
+    U8 good = turn == ColorW ? ResultWin : ResultDraw; 
+    U8 bad = turn == ColorW ? ResultDraw : ResultWin; 
+    U8 r = ResultInvalid; 
+
+    // moves into check lead to invalid positions, which do not add a result 
+    if (turn == ColorW) 
+    {
+        FOR_EACH_BIT(MovesK[wk], 
+        {
+            r |= db[KPKIndex(ColorB, sq, bk, pawn)]; 
+        });
+
+        if (GetRank(pawn) < 6) 
+        {
+            Square push = (Square) (pawn + 8); 
+            r |= db[KPKIndex(ColorB, wk, bk, push)]; 
+
+            Square push2 = (Square) (pawn + 16); 
+            if (GetRank(pawn) == 1 && push != wk && push != bk) 
+            {
+                r |= db[KPKIndex(ColorB, wk, bk, push2)]; 
+            }
+        }
+    }
+    else 
+    {
+        FOR_EACH_BIT(MovesK[bk], 
+        {
+            r |= db[KPKIndex(ColorW, wk, sq, pawn)]; 
+        });
+    }
+
+    if (r & good) return good; 
+    if (r & ResultUnknown) return ResultUnknown; 
+    return bad; 
+}
+
+/**
+ * Gets the result of a position that is known without looking at moves. 
+ * 
+ * @param turn Color to move 
+ * @param wk White king square 
+ * @param bk Black king square 
+ * @param pawn Pawn square 
+ * @return Result of the position 
+ */
+static U8 InitKPKResult(Color turn, Square wk, Square bk, Square pawn) 
+{
+    if (GetDistance(wk, bk) <= 1 || wk == pawn || bk == pawn) 
+    {
+        return ResultInvalid; 
+    }
+
+    // black cannot be in check with white to move 
+    if (turn == ColorW && (AttacksP[ColorW][pawn] & Bits[bk])) 
+    {
+        return ResultInvalid; 
+    }
+
+    Square promo = (Square) (pawn + 8); 
+
+    // the pawn promotes and the queen cannot be taken 
+    if (turn == ColorW && GetRank(pawn) == 6 && wk != promo 
+     && (GetDistance(bk, promo) > 1 || GetDistance(wk, promo) == 1)) 
+    {
+        return ResultWin; 
+    }
+
+    // stalemate or the pawn is taken 
+    Bitboard safe = ~(MovesK[wk] | AttacksP[ColorW][pawn]); 
+    if (turn == ColorB && (!(MovesK[bk] & safe) || (MovesK[bk] & ~MovesK[wk] & Bits[pawn]))) 
+    {
+        return ResultDraw; 
+    }
+
+    return ResultUnknown; 
+}
+
+/**
+ * Decodes a KPK index and calls an action with the position. 
+ */
+#define FOR_EACH_KPK(action) \
+    for (int idx = 0; idx < KPKSize; idx++) \
+    { \
+        Square wk = (Square) (idx & 63); \
+        Square bk = (Square) ((idx >> 6) & 63); \
+        Color turn = (Color) ((idx >> 12) & 1); \
+        Square pawn = (Square) (((idx >> 13) & 3) + 8 * (6 - (idx >> 15))); \
+        action; \
+    }
+
+/**
+ * Generates the KPK bitbase. 
+ */
+static void InitKPK(void) 
+{
+    U8* db = malloc(KPKSize); 
+
+    FOR_EACH_KPK( 
+    {
+        db[idx] = InitKPKResult(turn, wk, bk, pawn); 
+    });
+
+    // repeat until no unknown position can be resolved 
+    bool changed = true; 
+    while (changed) 
+    {
+        changed = false; 
+        FOR_EACH_KPK( 
+        {
+            if (db[idx] == ResultUnknown) 
+            {
+                db[idx] = ClassifyKPK(db, turn, wk, bk, pawn); 
+                changed |= db[idx] != ResultUnknown; 
+            }
+        });
+    }
+
+    // positions that are still unknown can never be won 
+    int wins = 0; 
+    for (int idx = 0; idx < KPKSize; idx++) 
+    {
+        if (db[idx] == ResultWin) 
+        {
+            KPKBits[idx / 32] |= 1U << (idx & 31); 
+            wins++; 
+        }
+    }
+
+#ifdef VALIDATION 
+    if (wins != 111282) 
+    {
+        printf("info string ERROR KPK bitbase has %d wins instead of 111282\n", wins); 
+    }
+#else 
+    (void) wins; 
+#endif 
+
+    free(db); 
+}
+
+void InitBitbase(void) 
+{
+    if (IsBitbaseInit) return; 
+
+    InitKPK(); 
+
+    IsBitbaseInit = true; 
+}
+
+bool ProbeKPK(Color strong, Square strongK, Square weakK, Square pawn, Color turn) 
+{
+    // squares are viewed as if the strong color is white 
+    if (strong == ColorB) 
+    {
+        strongK = FlipRank(strongK); 
+        weakK = FlipRank(weakK); 
+        pawn = FlipRank(pawn); 
+        turn = OppositeColor(turn); 
+    }
+
+    // the bitbase only has the pawn on files a-d 
+    if (GetFile(pawn) >= 4) 
+    {
+        strongK = (Square) (strongK ^ 7); 
+        weakK = (Square) (weakK ^ 7); 
+        pawn = (Square) (pawn ^ 7); 
+    }
+
+    int idx = KPKIndex(turn, strongK, weakK, pawn); 
+    return (KPKBits[idx / 32] >> (idx & 31)) & 1; 
+}
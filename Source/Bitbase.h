@@ -0,0 +1,37 @@
+/**
+ * @file Bitbase.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Defines endgame bitbases. 
+ * 
+ * The king and pawn against king bitbase stores one bit per position that 
+ * tells if the pawn wins. It is generated by retrograde analysis when the 
+ * first game is created. 
+ */
+
+#pragma once 
+
+#include <stdbool.h> 
+
+#include "Piece.h" 
+#include "Square.h" 
+
+/**
+ * Generates the bitbases if they have not been generated yet. 
+ */
+void InitBitbase(void); 
+
+/**
+ * Checks if king and pawn against king is a win. 
+ * 
+ * @param strong Color with the pawn 
+ * @param strongK Square of the king with the pawn 
+ * @param weakK Square of the lone king 
+ * @param pawn Square of the pawn 
+ * @param turn Color to move 
+ * @return True if the pawn wins, false if it is a draw 
+ */
+bool ProbeKPK(Color strong, Square strongK, Square weakK, Square pawn, Color turn); 
@@ -37,6 +37,8 @@ typedef U64 Bitboard;
 #define EmptyBK  0x6000000000000000ULL 
 #define EmptyBQ  0x0E00000000000000ULL 
 
+#define LightSquares 0x55AA55AA55AA55AAULL 
+
 #define AllBits  0xFFFFFFFFFFFFFFFFULL 
 #define NoBits   0ULL
 
@@ -106,16 +108,6 @@ extern const Bitboard SlideTo[NumSquares][NumSquares];
  */
 extern const U8 PinIndex[NumSquares][NumSquares]; 
 
-/**
- * Population count of all 16-bit integers. 
- */
-extern const U8 PopCount16[1 << 16]; 
-
-/**
- * Used for flipping bitboards. 
- */
-extern const U64 Reverse8Offset[8][256]; 
-
 /**
  * Highlights all squares with the file number provided. 
  */
@@ -286,14 +278,11 @@ static inline Bitboard FlipColumn(Bitboard b)
  */
 static inline Bitboard Rotate180(Bitboard b) 
 {
-    return Reverse8Offset[7][((b) & 255)] | 
-           Reverse8Offset[6][((b >>  8) & 255)] | 
-           Reverse8Offset[5][((b >> 16) & 255)] | 
-           Reverse8Offset[4][((b >> 24) & 255)] | 
-           Reverse8Offset[3][((b >> 32) & 255)] | 
-           Reverse8Offset[2][((b >> 40) & 255)] | 
-           Reverse8Offset[1][((b >> 48) & 255)] | 
-           Reverse8Offset[0][((b >> 56))];
+    // mirror files, then swap bytes to mirror ranks 
+    b = FlipColumn(b); 
+    b = (b & 0xFF00FF00FF00FF00ULL) >>  8 | (b & 0x00FF00FF00FF00FFULL) <<  8; 
+    b = (b & 0xFFFF0000FFFF0000ULL) >> 16 | (b & 0x0000FFFF0000FFFFULL) << 16; 
+    return b >> 32 | b << 32; 
 }
 
 // see: https://www.chessprogramming.org/BitScan 
@@ -310,7 +299,8 @@ static inline Bitboard Rotate180(Bitboard b)
  */
 static inline int LeastSigBit(Bitboard b) 
 {
-#if defined(BMI2) 
+#if defined(BMI2) || defined(__GNUC__) 
+    // tzcnt with BMI, otherwise bsf which every x86-64 CPU has 
     return __builtin_ctzll(b); 
 #else 
     // pre-calculated hash results  
@@ -351,7 +341,11 @@ static inline int LeastSigBit(Bitboard b)
  */
 static inline int MostSigBit(Bitboard b) 
 {
+#if defined(__GNUC__) 
+    return 63 ^ __builtin_clzll(b); 
+#else 
     return 63 - LeastSigBit(Rotate180(b)); 
+#endif
 }
 
 /**
@@ -365,10 +359,12 @@ static inline int PopCount(Bitboard b)
 #if defined(POPCNT) 
     return __builtin_popcountll(b);
 #else 
-    return PopCount16[((b >>  0) & 65535)]
-         + PopCount16[((b >> 16) & 65535)]
-         + PopCount16[((b >> 32) & 65535)]
-         + PopCount16[((b >> 48) & 65535)];
+    // count bits in parallel without a lookup table 
+    // see: https://www.chessprogramming.org/Population_Count 
+    b = b - ((b >> 1) & 0x5555555555555555ULL); 
+    b = (b & 0x3333333333333333ULL) + ((b >> 2) & 0x3333333333333333ULL); 
+    b = (b + (b >> 4)) & 0x0F0F0F0F0F0F0F0FULL; 
+    return (int) ((b * 0x0101010101010101ULL) >> 56); 
 #endif
 }
 
@@ -380,7 +376,7 @@ static inline int PopCount(Bitboard b)
  */
 static inline int PopCountU16(U16 b) 
 {
-    return PopCount16[b]; 
+    return PopCount((Bitboard) b); 
 }
 
 /**
@@ -0,0 +1,134 @@
+/**
+ * @file Dispatch.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Selects the engine build that matches the host CPU. 
+ * 
+ * With CPU_EXT=auto, the engine is compiled once for every instruction set 
+ * level and each copy has its own entry point. All other symbols of a copy 
+ * are made local when it is linked, so the copies cannot see each other. 
+ * This file provides main, which checks the CPU with cpuid and runs the 
+ * fastest copy it supports. 
+ */
+
+#include <stdbool.h> 
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+
+/**
+ * Environment variable that can force another supported backend. 
+ */
+#define BackendEnvVar "HALCYON_BACKEND" 
+
+int EngineMainGeneric(int argc, char** argv); 
+int EngineMainPopcnt(int argc, char** argv); 
+int EngineMainBmi2(int argc, char** argv); 
+int EngineMainAvx2Magic(int argc, char** argv); 
+int EngineMainAvx2(int argc, char** argv); 
+int EngineMainAvx512(int argc, char** argv); 
+
+/**
+ * Instruction set extensions a backend requires, combined as bit flags. 
+ */
+#define FeaturePopcnt 1 
+#define FeatureBmi2 2 
+#define FeatureAvx2 4 
+#define FeatureAvx512 8 
+
+/**
+ * Compiled copy of the engine. 
+ */
+typedef struct Backend Backend; 
+
+struct Backend 
+{
+    const char* Name; 
+    int (*Main)(int argc, char** argv); 
+    int Features; 
+    bool Pext; // slider attacks use PEXT instead of magic bitboards 
+};
+
+/**
+ * Backends from least to most preferred. 
+ */
+static const Backend Backends[] = 
+{
+    { "generic",   EngineMainGeneric,   0, false }, 
+    { "popcnt",    EngineMainPopcnt,    FeaturePopcnt, false }, 
+    { "bmi2",      EngineMainBmi2,      FeaturePopcnt | FeatureBmi2, true }, 
+    { "avx2magic", EngineMainAvx2Magic, FeaturePopcnt | FeatureAvx2, false }, 
+    { "avx2",      EngineMainAvx2,      FeaturePopcnt | FeatureBmi2 | FeatureAvx2, true }, 
+    { "avx512",    EngineMainAvx512,    FeaturePopcnt | FeatureBmi2 | FeatureAvx2 | FeatureAvx512, true }, 
+};
+
+#define NumBackends ((int) (sizeof(Backends) / sizeof(Backends[0]))) 
+
+/**
+ * @return Instruction set extensions of the host CPU 
+ */
+static int GetHostFeatures(void) 
+{
+    __builtin_cpu_init(); 
+
+    int features = 0; 
+    if (__builtin_cpu_supports("popcnt")) features |= FeaturePopcnt; 
+    if (__builtin_cpu_supports("bmi2")) features |= FeatureBmi2; 
+    if (__builtin_cpu_supports("avx2")) features |= FeatureAvx2; 
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) features |= FeatureAvx512; 
+    return features; 
+}
+
+/**
+ * @param features Instruction set extensions of the host CPU 
+ * @return Index of the most preferred backend the host CPU can run 
+ */
+static int GetHostBackend(int features) 
+{
+    // PEXT is microcoded and very slow before Zen 3, magics are faster there 
+    bool slowPext = __builtin_cpu_is("amd") 
+                 && (__builtin_cpu_is("znver1") || __builtin_cpu_is("znver2")); 
+
+    int best = 0; 
+    for (int i = 0; i < NumBackends; i++) 
+    {
+        if ((Backends[i].Features & ~features) == 0 && !(slowPext && Backends[i].Pext)) best = i; 
+    }
+
+    return best; 
+}
+
+/**
+ * Runs the fastest engine copy the host supports. 
+ * 
+ * @param argc Number of arguments 
+ * @param argv Arguments 
+ * @return Exit code of the engine 
+ */
+int main(int argc, char** argv) 
+{
+    int features = GetHostFeatures(); 
+    int backend = GetHostBackend(features); 
+
+    // another backend can be requested to compare backends on the same machine 
+    const char* forced = getenv(BackendEnvVar); 
+    if (forced && *forced) 
+    {
+        int i = 0; 
+        while (i < NumBackends && strcmp(Backends[i].Name, forced) != 0) i++; 
+
+        if (i == NumBackends || (Backends[i].Features & ~features) != 0) 
+        {
+            printf("info string %s=%s is unknown or not supported by this CPU\n", BackendEnvVar, forced); 
+        }
+        else 
+        {
+            backend = i; 
+        }
+    }
+
+    return Backends[backend].Main(argc, argv); 
+}
@@ -9,6 +9,7 @@
  */
 
 #include "Game.h" 
+#include "Material.h" 
 
 int PassedPawnValues[] = 
 {
@@ -34,6 +35,11 @@ int PieceTypeValues[] =
     91,  321,  331,  519,  964,
 };
 
+const int PhaseValues[] = 
+{
+    0, 1, 1, 2, 4, 0 
+};
+
 int AttackUnitValues[] = 
 {
       0,    2,    8,   10,   11,   13,   14,   15, 
@@ -255,40 +261,17 @@ int GetNumEvalParams(void)
     return num; 
 }
 
-/**
- * Add white piece-square bonuses to middlegame and endgame. 
- * 
- * @param g The game 
- * @param pc Type of piece 
- * @param mg Current middlegame eval
- * @param eg Current endgame eval 
- */
-static inline void EvalWPieceSquare(const Game* g, PieceType pc, int* mg, int* eg) 
+void ComputeEvalState(const Game* g, EvalState* es) 
 {
-    Bitboard pcs = g->Pieces[MakePiece(pc, ColorW)]; 
-    FOR_EACH_BIT(pcs, 
-    {
-        *mg += PieceSquare[0][pc][FlipRank(sq)]; 
-        *eg += PieceSquare[1][pc][FlipRank(sq)]; 
-    });
-}
+    memset(es, 0, sizeof(EvalState)); 
 
-/**
- * Add black piece-square bonuses to middlegame and endgame. 
- * 
- * @param g The game 
- * @param pc Type of piece 
- * @param mg Current middlegame eval
- * @param eg Current endgame eval 
- */
-static inline void EvalBPieceSquare(const Game* g, PieceType pc, int* mg, int* eg) 
-{
-    Bitboard pcs = g->Pieces[MakePiece(pc, ColorB)]; 
-    FOR_EACH_BIT(pcs, 
+    for (Piece pc = 0; pc < NumPieces; pc++) 
     {
-        *mg -= PieceSquare[0][pc][sq]; 
-        *eg -= PieceSquare[1][pc][sq]; 
-    });
+        FOR_EACH_BIT(g->Pieces[pc], 
+        {
+            UpdateEvalState(es, pc, sq, 1); 
+        });
+    }
 }
 
 /**
@@ -338,9 +321,10 @@ static inline int EvalOpenFiles(const Game* g, Color col)
  * 
  * @param g The game 
  * @param col Color to evaluate
+ * @param oppPawnAttacks Squares attacked by enemy pawns 
  * @return King safety bonuses 
  */
-static inline int EvalAttackUnits(const Game* g, Color col) 
+static inline int EvalAttackUnits(const Game* g, Color col, Bitboard oppPawnAttacks) 
 {
     Square ksq = LeastSigBit(g->Pieces[MakePiece(PieceK, col)]); 
     Bitboard region = Bits[ksq] | MovesK[ksq]; 
@@ -355,7 +339,7 @@ static inline int EvalAttackUnits(const Game* g, Color col)
         region |= ShiftS(region); 
     }
 
-    int units = GetAttackUnits(g, region, col); 
+    int units = GetAttackUnits(g, region, col, oppPawnAttacks); 
     if (units > 63) units = 63; 
     return AttackUnitValues[units]; 
 }
@@ -488,7 +472,38 @@ static inline void EvalBPawnStructure(
     }
 }
 
-int EvaluateVerbose(const Game* g, int ply, int nMoves, bool draw, int contempt, bool verbose) 
+/**
+ * Computes pawn structure terms and pawn attacks. 
+ * 
+ * @param g The game 
+ * @param entry Output, the key is not set 
+ */
+static inline void EvalPawnEntry(const Game* g, PawnEntry* entry) 
+{
+    int wpIso = 0, wpBack = 0, wpDoub = 0, wpTrip = 0, wpPass = 0, wpPassEval = 0; 
+    EvalWPawnStructure(g, &wpIso, &wpBack, &wpDoub, &wpTrip, &wpPass, &wpPassEval); 
+
+    int bpIso = 0, bpBack = 0, bpDoub = 0, bpTrip = 0, bpPass = 0, bpPassEval = 0; 
+    EvalBPawnStructure(g, &bpIso, &bpBack, &bpDoub, &bpTrip, &bpPass, &bpPassEval); 
+
+    entry->Eval = wpPassEval 
+                + wpIso * PawnStructureValues[0] 
+                + wpBack * PawnStructureValues[1] 
+                + wpDoub * PawnStructureValues[2] 
+                + wpTrip * PawnStructureValues[3] 
+                - bpPassEval 
+                - bpIso * PawnStructureValues[0] 
+                - bpBack * PawnStructureValues[1] 
+                - bpDoub * PawnStructureValues[2] 
+                - bpTrip * PawnStructureValues[3]; 
+
+    Bitboard wp = g->Pieces[PieceWP]; 
+    Bitboard bp = g->Pieces[PieceBP]; 
+    entry->Attacks[ColorW] = ShiftNW(wp) | ShiftNE(wp); 
+    entry->Attacks[ColorB] = ShiftSW(bp) | ShiftSE(bp); 
+}
+
+int EvaluateVerbose(const Game* g, PawnTable* pawns, MaterialTable* materials, int ply, int nMoves, bool draw, int contempt, bool verbose) 
 {
     if (draw) 
     {   
@@ -509,77 +524,64 @@ int EvaluateVerbose(const Game* g, int ply, int nMoves, bool draw, int contempt,
         }
     }
 
-    int wp = g->Counts[PieceWP]; 
-    int bp = g->Counts[PieceBP]; 
-    int wn = g->Counts[PieceWN]; 
-    int bn = g->Counts[PieceBN]; 
-    int wb = g->Counts[PieceWB]; 
-    int bb = g->Counts[PieceBB]; 
-    int wr = g->Counts[PieceWR]; 
-    int br = g->Counts[PieceBR]; 
-    int wq = g->Counts[PieceWQ]; 
-    int bq = g->Counts[PieceBQ]; 
-    int wk = g->Counts[PieceWK]; 
-    int bk = g->Counts[PieceBK]; 
-
-    int eval = 0; 
-    int mg = 0; 
-    int eg = 0; 
-
-    eval += PieceTypeValues[PieceP] * (wp - bp); 
-    eval += PieceTypeValues[PieceN] * (wn - bn); 
-    eval += PieceTypeValues[PieceB] * (wb - bb); 
-    eval += PieceTypeValues[PieceR] * (wr - br); 
-    eval += PieceTypeValues[PieceQ] * (wq - bq); 
-    eval += 10000 * (wk - bk); 
+    // terms that only depend on piece counts are computed once per material hash 
+    MaterialEntry localMaterial; 
+    const MaterialEntry* material = ProbeMaterial(materials, g, &localMaterial); 
+
+    int endgameEval; 
+    if (material->Endgame != EndgameNone && EvalEndgame(g, material, &endgameEval)) 
+    {
+        if (verbose) 
+        {
+            printf("Endgame evaluation: %d\n", endgameEval); 
+        }
+        return endgameEval; 
+    }
+
+    // the network replaces all classical terms 
+    if (UseNnue) 
+    {
+        // keep network scores below known wins and mate scores 
+        int nnueEval = EvaluateNnue(g); 
+        if (nnueEval > KnownWinValue - 1) nnueEval = KnownWinValue - 1; 
+        if (nnueEval < 1 - KnownWinValue) nnueEval = 1 - KnownWinValue; 
+        if (verbose) 
+        {
+            printf("Network evaluation: %d\n", nnueEval); 
+        }
+        return nnueEval; 
+    }
+
+    // material and piece-square values are updated as moves are made 
+    int eval = g->Eval.Material; 
+    int mg = g->Eval.Mg; 
+    int eg = g->Eval.Eg; 
 
     // bishop pair 
-    eval += BishopPair * ((wb >= 2) - (bb >= 2)); 
+    eval += material->Imbalance; 
+
+    // pawn structure only needs to be evaluated once per pawn hash 
+    PawnEntry local; 
+    PawnEntry* pawnEntry = &local; 
+    if (pawns) 
+    {
+        pawnEntry = ProbePawnTable(pawns, g->PawnHash); 
+        if (pawnEntry->Key != g->PawnHash) 
+        {
+            EvalPawnEntry(g, pawnEntry); 
+            pawnEntry->Key = g->PawnHash; 
+        }
+    }
+    else 
+    {
+        EvalPawnEntry(g, &local); 
+    }
 
     // this is reversed because it is checking how (un)safe that color's king is 
     // and returning a higher value for less safe 
-    eval += EvalAttackUnits(g, ColorB) - EvalAttackUnits(g, ColorW); 
-
-    int wpIso = 0; 
-    int wpBack = 0; 
-    int wpDoub = 0; 
-    int wpTrip = 0; 
-    int wpPass = 0; 
-    int wpPassEval = 0; 
-    EvalWPawnStructure(g, &wpIso, &wpBack, &wpDoub, &wpTrip, &wpPass, &wpPassEval); 
-
-    eval += wpPassEval
-          + wpIso * PawnStructureValues[0] 
-          + wpBack * PawnStructureValues[1] 
-          + wpDoub * PawnStructureValues[2] 
-          + wpTrip * PawnStructureValues[3]; 
-
-    int bpIso = 0; 
-    int bpBack = 0; 
-    int bpDoub = 0; 
-    int bpTrip = 0; 
-    int bpPass = 0; 
-    int bpPassEval = 0; 
-    EvalBPawnStructure(g, &bpIso, &bpBack, &bpDoub, &bpTrip, &bpPass, &bpPassEval); 
+    eval += EvalAttackUnits(g, ColorB, pawnEntry->Attacks[ColorW]) - EvalAttackUnits(g, ColorW, pawnEntry->Attacks[ColorB]); 
 
-    eval -= bpPassEval
-          + bpIso * PawnStructureValues[0] 
-          + bpBack * PawnStructureValues[1] 
-          + bpDoub * PawnStructureValues[2] 
-          + bpTrip * PawnStructureValues[3]; 
-
-    EvalWPieceSquare(g, PieceP, &mg, &eg); 
-    EvalBPieceSquare(g, PieceP, &mg, &eg); 
-    EvalWPieceSquare(g, PieceN, &mg, &eg); 
-    EvalBPieceSquare(g, PieceN, &mg, &eg); 
-    EvalWPieceSquare(g, PieceB, &mg, &eg); 
-    EvalBPieceSquare(g, PieceB, &mg, &eg); 
-    EvalWPieceSquare(g, PieceR, &mg, &eg); 
-    EvalBPieceSquare(g, PieceR, &mg, &eg); 
-    EvalWPieceSquare(g, PieceQ, &mg, &eg); 
-    EvalBPieceSquare(g, PieceQ, &mg, &eg); 
-    EvalWPieceSquare(g, PieceK, &mg, &eg); 
-    EvalBPieceSquare(g, PieceK, &mg, &eg); 
+    eval += pawnEntry->Eval; 
 
     int cwr = EvalRooks(g, ColorW); 
     int cbr = EvalRooks(g, ColorB); 
@@ -589,22 +591,24 @@ int EvaluateVerbose(const Game* g, int ply, int nMoves, bool draw, int contempt,
     int bOpen = EvalOpenFiles(g, ColorB); 
     eval += wOpen - bOpen; 
 
-    // int p = 0 * (wp - bp);  
-    int n = 1 * (wn + bn); 
-    int b = 1 * (wb + bb); 
-    int r = 2 * (wr + br); 
-    // quick way to ignore extra queens 
-    int q = 4 * ((wq > 0) + (bq > 0)); 
-
-    // between 0 and (4+4+8+8)=24
-    int phase = 24 - (n + b + r + q); 
-    phase = (phase >= 0) * phase; 
+    // between 0 and (4+4+8+8)=24, extra material from promotions is ignored 
+    int phase = material->Phase; 
     // printf("phase %d mg %d eg %d eval %d\n", phase, mg, eg, (mg * (32 - phase) + eg * phase) / 32); 
 
     eval += (mg * (24 - phase) + eg * phase) / 24; 
+
+    // material that is hard to win with brings the evaluation closer to a draw 
+    int scale = GetScaleFactor(g, material, eval > 0 ? ColorW : ColorB); 
+    eval = eval * scale / ScaleNormal; 
     
     if (verbose) 
     {
+        int wpIso = 0, wpBack = 0, wpDoub = 0, wpTrip = 0, wpPass = 0, wpPassEval = 0; 
+        EvalWPawnStructure(g, &wpIso, &wpBack, &wpDoub, &wpTrip, &wpPass, &wpPassEval); 
+
+        int bpIso = 0, bpBack = 0, bpDoub = 0, bpTrip = 0, bpPass = 0, bpPassEval = 0; 
+        EvalBPawnStructure(g, &bpIso, &bpBack, &bpDoub, &bpTrip, &bpPass, &bpPassEval); 
+
         printf("Game phase: %.0f / 100\n", phase / 24.0 * 100); 
         printf("Middlegame piece-square: %d\n", mg); 
         printf("Endgame piece-square: %d\n", eg); 
@@ -615,6 +619,7 @@ int EvaluateVerbose(const Game* g, int ply, int nMoves, bool draw, int contempt,
         printf("Passed pawns (%d-%d): %d\n", wpPass, bpPass, wpPassEval - bpPassEval); 
         printf("Connected rooks (%d-%d): %d\n", cwr, cbr, cwr - cbr); 
         printf("Open files (%d-%d): %d\n", wOpen, bOpen, wOpen - bOpen); 
+        printf("Scale factor: %d / %d\n", scale, ScaleNormal); 
         printf("Final evaluation: %d\n", eval); 
     }
 
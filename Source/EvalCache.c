@@ -0,0 +1,31 @@
+/**
+ * @file EvalCache.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Implements the static evaluation cache. 
+ */
+
+#include "EvalCache.h" 
+
+#include <stdlib.h> 
+#include <string.h> 
+
+void CreateEvalCache(EvalCache* ec) 
+{
+    ec->Entries = calloc(EvalCacheSize, sizeof(EvalCacheEntry)); 
+    ec->Probes = 0; 
+    ec->Hits = 0; 
+}
+
+void DestroyEvalCache(EvalCache* ec) 
+{
+    free(ec->Entries); 
+}
+
+void ClearEvalCache(EvalCache* ec) 
+{
+    memset(ec->Entries, 0, EvalCacheSize * sizeof(EvalCacheEntry)); 
+}
@@ -0,0 +1,99 @@
+/**
+ * @file EvalCache.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Defines the static evaluation cache. 
+ * 
+ * Search evaluates the same positions again in later iterations and when 
+ * an aspiration window fails. The static evaluation of each position is 
+ * stored by its hash, so those positions are not evaluated again. Each 
+ * search thread has its own cache. 
+ */
+
+#pragma once 
+
+#include <stdbool.h> 
+
+#include "Types.h" 
+#include "Zobrist.h" 
+
+/**
+ * Number of entries in an eval cache (must be a power of two). 
+ */
+#define EvalCacheSize 32768 
+
+/**
+ * Static evaluation cache. 
+ */
+typedef struct EvalCache EvalCache; 
+
+/**
+ * Data layout: 
+ * eval: 0-31 (signed) 
+ * key: 32-63 (upper bits of the hash, the lower bits are the index) 
+ */
+typedef U64 EvalCacheEntry; 
+
+struct EvalCache 
+{
+    EvalCacheEntry* Entries; 
+    U64 Probes; 
+    U64 Hits; 
+};
+
+/**
+ * Initializes an empty eval cache. 
+ * 
+ * @param ec The cache 
+ */
+void CreateEvalCache(EvalCache* ec); 
+
+/**
+ * Deinitializes an eval cache. 
+ * 
+ * @param ec The cache 
+ */
+void DestroyEvalCache(EvalCache* ec); 
+
+/**
+ * Removes all entries from an eval cache. This must be called when the 
+ * evaluation function changes. 
+ * 
+ * @param ec The cache 
+ */
+void ClearEvalCache(EvalCache* ec); 
+
+/**
+ * Queries the static evaluation of a position. 
+ * 
+ * @param ec The cache 
+ * @param key Game state hash 
+ * @param eval Output static evaluation 
+ * @return True if found, false otherwise 
+ */
+static inline bool FindCachedEval(EvalCache* ec, Zobrist key, int* eval) 
+{
+    EvalCacheEntry entry = ec->Entries[key & (EvalCacheSize - 1)]; 
+
+    ec->Probes++; 
+    if ((entry >> 32) != (key >> 32) || !entry) return false; 
+
+    ec->Hits++; 
+    *eval = (int) (S32) (entry & 0xFFFFFFFF); 
+    return true; 
+}
+
+/**
+ * Stores the static evaluation of a position. 
+ * 
+ * @param ec The cache 
+ * @param key Game state hash 
+ * @param eval Static evaluation 
+ */
+static inline void StoreCachedEval(EvalCache* ec, Zobrist key, int eval) 
+{
+    ec->Entries[key & (EvalCacheSize - 1)] = (key & 0xFFFFFFFF00000000ULL) | (U32) eval; 
+}
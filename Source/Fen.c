@@ -261,6 +261,9 @@ void LoadFen(Game* g, const char* fen)
 
     g->InCheck = IsAttacked(g, LeastSigBit(g->Pieces[MakePiece(PieceK, g->Turn)]), g->Turn); 
 
+    ComputeEvalState(g, &g->Eval); 
+    if (g->Acc) RefreshAccumulator(g); 
+
     for (Square sq = A1; sq <= H8; sq++) 
     {
         for (Piece pc = 0; pc < NumPieces; pc++) 
@@ -268,6 +271,7 @@ void LoadFen(Game* g, const char* fen)
             if (GetBit(g->Pieces[pc], sq)) 
             {
                 g->Hash ^= HashSquarePiece(sq, pc); 
+                g->PawnHash ^= HashPawnSquare(sq, pc); 
             }
         }
     }
@@ -275,6 +279,8 @@ void LoadFen(Game* g, const char* fen)
     g->Hash ^= HashCastleFlags(g->Castle); 
     g->Hash ^= HashEnPassant(g->EnPassant); 
     g->Hash ^= (g->Turn == ColorB) * HashColor(); 
+
+    g->MaterialHash = HashMaterialCounts(g->Counts); 
 }
 
 void ToFen(const Game* g, char* out) 
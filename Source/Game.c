@@ -10,12 +10,16 @@
 
 #include "Game.h" 
 
+#include <stdatomic.h> 
 #include <stdlib.h> 
 #include <string.h> 
+#include <pthread.h> 
 
+#include "Bitbase.h" 
 #include "Bitboard.h"
 #include "Castle.h"
 #include "Mailbox.h"
+#include "Material.h" 
 #include "Move.h"
 #include "MoveGen.h"
 #include "Piece.h"
@@ -25,18 +29,21 @@
 Game* NewGame(void) 
 {
     Game* g = malloc(sizeof(Game)); 
+    g->Acc = NULL; 
     ResetGame(g); 
     return g; 
 }
 
 void FreeGame(Game* g) 
 {
+    free(g->Acc); 
     free(g); 
 }
 
 void ResetGame(Game* g) 
 {
     InitHash(); 
+    InitBitbase(); 
     InitMailbox(&g->Board); 
     memset(g->Pieces, 0, sizeof(g->Pieces)); 
     memset(g->Colors, 0, sizeof(g->Colors)); 
@@ -44,10 +51,14 @@ void ResetGame(Game* g)
     g->All = 0; 
     g->Movement = 0; 
     g->Hash = 0; 
+    g->PawnHash = 0; 
+    g->MaterialHash = 0; 
     g->Castle = 0; 
     g->EnPassant = NoSquare; 
+    memset(&g->Eval, 0, sizeof(g->Eval)); 
     g->Ply = 0; 
     g->Halfmove = 0; 
+    g->PliesFromNull = 0; 
     g->Turn = ColorW; 
     g->InCheck = false; 
     g->Nodes = 0; 
@@ -57,6 +68,7 @@ void ResetGame(Game* g)
 void CopyGame(Game* g, const Game* from) 
 {
     InitHash(); 
+    InitBitbase(); 
     g->Board = from->Board; 
     memcpy(g->Pieces, from->Pieces, sizeof(g->Pieces)); 
     memcpy(g->Colors, from->Colors, sizeof(g->Colors)); 
@@ -64,10 +76,14 @@ void CopyGame(Game* g, const Game* from)
     g->All = from->All; 
     g->Movement = from->Movement; 
     g->Hash = from->Hash; 
+    g->PawnHash = from->PawnHash; 
+    g->MaterialHash = from->MaterialHash; 
     g->Castle = from->Castle; 
     g->EnPassant = from->EnPassant; 
+    g->Eval = from->Eval; 
     g->Ply = from->Ply; 
     g->Halfmove = from->Halfmove; 
+    g->PliesFromNull = from->PliesFromNull; 
     g->Turn = from->Turn; 
     g->InCheck = from->InCheck; 
     g->Nodes = 0; 
@@ -76,6 +92,9 @@ void CopyGame(Game* g, const Game* from)
     {
         g->Hist[i] = from->Hist[i]; 
     }
+
+    // accumulators are not copied, existing ones are computed for the new board 
+    if (g->Acc) RefreshAccumulator(g); 
 }
 
 /**
@@ -94,6 +113,8 @@ bool EqualsTTableGame(const Game* a, const Game* b)
     GAME_EQ(All); 
     GAME_EQ(Movement); 
     GAME_EQ(Hash); 
+    GAME_EQ(PawnHash); 
+    GAME_EQ(MaterialHash); 
     GAME_EQ(Castle); 
     GAME_EQ(EnPassant); 
     // GAME_EQ(Ply); 
@@ -163,13 +184,19 @@ void PushMove(Game* g, Move mv)
 {
     g->Nodes++; 
 
+    if (g->Acc) PushAccumulator(g, mv); 
+
     // store anything that the move doesn't store 
     MoveHist* hist = g->Hist + g->Depth++; 
     hist->Halfmove = g->Halfmove; 
+    hist->PliesFromNull = g->PliesFromNull; 
     hist->EnPassant = g->EnPassant; 
     hist->Castle = g->Castle; 
     hist->InCheck = g->InCheck; 
     hist->Hash = g->Hash; 
+    hist->PawnHash = g->PawnHash; 
+    hist->MaterialHash = g->MaterialHash; 
+    hist->Eval = g->Eval; 
 
     // swap color and reset en passant hash
     g->Hash ^= HashColor(); 
@@ -200,6 +227,7 @@ void PushMove(Game* g, Move mv)
     {
         g->Halfmove++; 
     }
+    g->PliesFromNull++; 
 
     if (ep) // en passant 
     {
@@ -219,11 +247,20 @@ void PushMove(Game* g, Move mv)
         g->Hash ^= HashSquarePiece(dst, pc); 
         g->Hash ^= HashSquarePiece(rm, tgt); 
 
+        g->PawnHash ^= HashPawnSquare(src, pc); 
+        g->PawnHash ^= HashPawnSquare(dst, pc); 
+        g->PawnHash ^= HashPawnSquare(rm, tgt); 
+
         ClearPieceAt(&g->Board, src); 
         ClearPieceAt(&g->Board, rm); 
         SetPieceAt(&g->Board, dst, pc); 
 
+        UpdateEvalState(&g->Eval, pc, src, -1); 
+        UpdateEvalState(&g->Eval, pc, dst, 1); 
+        UpdateEvalState(&g->Eval, tgt, rm, -1); 
+
         // enemy piece has been captured 
+        g->MaterialHash ^= HashMaterial(tgt, g->Counts[tgt]); 
         g->Counts[tgt]--; 
 
         // after en passant, a new en passant square is not possible 
@@ -248,6 +285,11 @@ void PushMove(Game* g, Move mv)
         SetPieceAt(&g->Board, MoveCastleSquareK[casIndex][1], pc); 
         SetPieceAt(&g->Board, MoveCastleSquareR[casIndex][1], MakePiece(PieceR, col)); 
 
+        UpdateEvalState(&g->Eval, pc, MoveCastleSquareK[casIndex][0], -1); 
+        UpdateEvalState(&g->Eval, pc, MoveCastleSquareK[casIndex][1], 1); 
+        UpdateEvalState(&g->Eval, MakePiece(PieceR, col), MoveCastleSquareR[casIndex][0], -1); 
+        UpdateEvalState(&g->Eval, MakePiece(PieceR, col), MoveCastleSquareR[casIndex][1], 1); 
+
         // en passant square is not possible after castling 
         g->EnPassant = NoSquare; 
     }
@@ -265,6 +307,9 @@ void PushMove(Game* g, Move mv)
         g->Hash ^= HashSquarePiece(dst, pro); 
         g->Hash ^= HashSquarePiece(dst, tgt); 
 
+        // only the promoted pawn is removed, pawns can't be captured on the last rank 
+        g->PawnHash ^= HashPawnSquare(src, pc); 
+
         g->Pieces[pc] ^= srcPos; 
         g->Pieces[pro] ^= dstPos; 
         g->Pieces[tgt] ^= dstPos; 
@@ -272,9 +317,16 @@ void PushMove(Game* g, Move mv)
         ClearPieceAt(&g->Board, src); 
         SetPieceAt(&g->Board, dst, pro); 
 
+        UpdateEvalState(&g->Eval, pc, src, -1); 
+        UpdateEvalState(&g->Eval, pro, dst, 1); 
+        if (tgt != NoPiece) UpdateEvalState(&g->Eval, tgt, dst, -1); 
+
+        g->MaterialHash ^= HashMaterial(tgt, g->Counts[tgt]); 
+        g->MaterialHash ^= HashMaterial(pc, g->Counts[pc]); 
         g->Counts[tgt]--; 
         g->Counts[pc]--; 
         g->Counts[pro]++; 
+        g->MaterialHash ^= HashMaterial(pro, g->Counts[pro]); 
 
         // en passant is not possible after promoting a pawn
         g->EnPassant = NoSquare; 
@@ -292,12 +344,21 @@ void PushMove(Game* g, Move mv)
         g->Hash ^= HashSquarePiece(dst, pc); 
         g->Hash ^= HashSquarePiece(dst, tgt); 
 
+        g->PawnHash ^= HashPawnSquare(src, pc); 
+        g->PawnHash ^= HashPawnSquare(dst, pc); 
+        g->PawnHash ^= HashPawnSquare(dst, tgt); 
+
         g->Pieces[pc] ^= srcPos ^ dstPos; 
         g->Pieces[tgt] ^= dstPos; 
         
         ClearPieceAt(&g->Board, src); 
         SetPieceAt(&g->Board, dst, pc); 
 
+        UpdateEvalState(&g->Eval, pc, src, -1); 
+        UpdateEvalState(&g->Eval, pc, dst, 1); 
+        if (tgt != NoPiece) UpdateEvalState(&g->Eval, tgt, dst, -1); 
+
+        g->MaterialHash ^= HashMaterial(tgt, g->Counts[tgt]); 
         g->Counts[tgt]--; 
 
         // en passant is possible if a pawn moved two squares 
@@ -346,11 +407,15 @@ void PopMove(Game* g, Move mv)
     // return anything that the move doesn't store 
     MoveHist* hist = g->Hist + --g->Depth; 
     g->Halfmove = hist->Halfmove; 
+    g->PliesFromNull = hist->PliesFromNull; 
     g->EnPassant = hist->EnPassant; 
     g->Castle = hist->Castle; 
     g->InCheck = hist->InCheck; 
-    // no need to recalculate hash 
+    // no need to recalculate hash or eval terms 
     g->Hash = hist->Hash; 
+    g->PawnHash = hist->PawnHash; 
+    g->MaterialHash = hist->MaterialHash; 
+    g->Eval = hist->Eval; 
 
     Piece pc = FromPiece(mv); 
     Piece pro = PromotionPiece(mv); 
@@ -453,8 +518,12 @@ void PushNullMove(Game* g)
 {
     g->Nodes++; 
 
+    // no piece moves, so the accumulator is unchanged 
+    if (g->Acc) g->Acc[g->Depth + 1] = g->Acc[g->Depth]; 
+
     MoveHist* hist = g->Hist + g->Depth++; 
     hist->Halfmove = g->Halfmove; 
+    hist->PliesFromNull = g->PliesFromNull; 
     hist->EnPassant = g->EnPassant; 
     hist->Castle = g->Castle; 
     hist->InCheck = g->InCheck; 
@@ -465,6 +534,11 @@ void PushNullMove(Game* g)
 
     g->Hash ^= HashColor(); 
 
+    // positions before a null move don't count as repetitions 
+    g->PliesFromNull = 0; 
+
+    // eval terms don't depend on the side to move so they are unchanged 
+
     // opponent should not be able to en passant just because we skipped a turn 
     g->Hash ^= HashEnPassant(g->EnPassant); 
     g->EnPassant = NoSquare; 
@@ -492,6 +566,7 @@ void PopNullMove(Game* g)
 
     MoveHist* hist = g->Hist + --g->Depth; 
     g->Halfmove = hist->Halfmove; 
+    g->PliesFromNull = hist->PliesFromNull; 
     g->EnPassant = hist->EnPassant; 
     g->Castle = hist->Castle; 
     g->InCheck = hist->InCheck; 
@@ -503,45 +578,148 @@ void PopNullMove(Game* g)
     VALIDATE_GAME_MOVE(g, 0, "popping null"); 
 }
 
+/**
+ * Gets how many plies back a position can repeat: positions before the 
+ * last capture, pawn move or null move, or before the history, cannot. 
+ * 
+ * @param g The game 
+ * @return Number of plies to search for repetitions 
+ */
+static inline int RepetitionPlies(const Game* g) 
+{
+    int end = g->Halfmove < g->PliesFromNull ? g->Halfmove : g->PliesFromNull; 
+    return end < g->Depth ? end : g->Depth; 
+}
+
 bool IsSpecialDraw(const Game* g) 
 {
     // 50-move rule 
     if (g->Halfmove > 99) return true; 
 
-    for (int i = 0; i < DrawDepth; i++) 
+    // only positions since the last capture, pawn move or null move can repeat 
+    // (g->Depth-i) is the position i plies ago, the side to move matches every 2 plies 
+    int end = RepetitionPlies(g); 
+    for (int i = 4; i <= end; i += 2) 
     {
-        // (g->Depth-1) is previous ply (opponent made the move)
-        // so our first depth to check should be (g->Depth-2)
-        int depth = (g->Depth-2) - i*2; 
+        if (g->Hash == g->Hist[g->Depth - i].Hash) return true; 
+    }
 
-        if (depth >= 0) 
-        {
-            if (g->Hash == g->Hist[depth].Hash) return true; 
-            if ((g->Hash ^ HashColor()) == g->Hist[depth].Hash) return true; 
-        }
-        else 
+    // insufficient material (guaranteed)
+    return IsMaterialDraw(g->Counts); 
+}
+
+bool HasUpcomingRepetition(const Game* g, int ply) 
+{
+    int end = RepetitionPlies(g); 
+
+    // the position i plies ago has the other side to move, so it is one 
+    // move away from the current position 
+    for (int i = 3; i <= end && i < ply; i += 2) 
+    {
+        Zobrist diff = g->Hash ^ g->Hist[g->Depth - i].Hash; 
+
+        int slot = CuckooSlot1(diff); 
+        if (CuckooHashValues[slot] != diff) 
         {
-            break; 
+            slot = CuckooSlot2(diff); 
+            if (CuckooHashValues[slot] != diff) continue; 
         }
+
+        // the move is only possible if no piece is in the way 
+        Move mv = CuckooMoves[slot]; 
+        Square from = FromSquare(mv); 
+        Square to = ToSquare(mv); 
+        if ((SlideTo[from][to] & InverseBits[to] & g->All) == 0) return true; 
     }
 
-    // insufficient material (guaranteed)
-    if (g->Pieces[PieceWK] == g->Colors[ColorW]) // white only has king
+    return false; 
+}
+
+/**
+ * Piece values for static exchange evaluation. 
+ * Knights and bishops are equal so trades between them are even. 
+ */
+static const int SeeValues[] = 
+{
+    100, 325, 325, 500, 1000, 20000, 0 
+};
+
+bool SeeAtLeast(const Game* g, Move mv, int threshold) 
+{
+    // castling never loses material 
+    if (CastleIndex(mv)) return threshold <= 0; 
+
+    Square from = FromSquare(mv); 
+    Square to = ToSquare(mv); 
+
+    // material won by the move itself 
+    int swap = SeeValues[TypeOfPiece(TargetPiece(mv))] - threshold; 
+    if (IsPromotion(mv)) 
     {
-        // KN vs K
-        if ((g->Pieces[PieceBK] | g->Pieces[PieceBN]) == g->Colors[ColorB] && g->Counts[PieceBN] <= 1) return true; 
-        // KB vs K
-        if ((g->Pieces[PieceBK] | g->Pieces[PieceBB]) == g->Colors[ColorB] && g->Counts[PieceBB] <= 1) return true;  
+        swap += SeeValues[TypeOfPiece(PromotionPiece(mv))] - SeeValues[PieceP]; 
     }
-    else if (g->Pieces[PieceBK] == g->Colors[ColorB]) // black only has king 
+    if (swap < 0) return false; 
+
+    // material lost if the piece is captured right away 
+    swap = SeeValues[TypeOfPiece(PromotionPiece(mv))] - swap; 
+    if (swap <= 0) return true; 
+
+    Bitboard occ = g->All ^ Bits[from] ^ Bits[to]; 
+    if (IsEnPassant(mv)) 
     {
-        // KN vs K
-        if ((g->Pieces[PieceWK] | g->Pieces[PieceWN]) == g->Colors[ColorW] && g->Counts[PieceWN] <= 1) return true; 
-        // KB vs K
-        if ((g->Pieces[PieceWK] | g->Pieces[PieceWB]) == g->Colors[ColorW] && g->Counts[PieceWB] <= 1) return true;  
+        // captured pawn is beside the moving pawn 
+        occ ^= Bits[to ^ 8]; 
     }
 
-    return false; 
+    Bitboard allRQ = g->Pieces[PieceWR] | g->Pieces[PieceBR] | g->Pieces[PieceWQ] | g->Pieces[PieceBQ]; 
+    Bitboard allBQ = g->Pieces[PieceWB] | g->Pieces[PieceBB] | g->Pieces[PieceWQ] | g->Pieces[PieceBQ]; 
+    Bitboard attackers = GetAllAttackers(g, to, occ); 
+
+    // res is 1 while the side that made the move is ahead 
+    Color col = g->Turn; 
+    int res = 1; 
+    while (true) 
+    {
+        col = OppositeColor(col); 
+        attackers &= occ; 
+
+        Bitboard colAtt = attackers & g->Colors[col]; 
+        if (!colAtt) break; 
+
+        res ^= 1; 
+
+        // capture with the least valuable attacker 
+        PieceType type; 
+        Bitboard bb = 0; 
+        for (type = PieceP; type < PieceK; type++) 
+        {
+            bb = colAtt & g->Pieces[MakePiece(type, col)]; 
+            if (bb) break; 
+        }
+
+        // the king can only capture if the square is not defended 
+        if (type == PieceK) 
+        {
+            return (attackers & ~g->Colors[col]) ? res ^ 1 : res; 
+        }
+
+        swap = SeeValues[type] - swap; 
+        if (swap < res) break; 
+
+        occ ^= Bits[LeastSigBit(bb)]; 
+
+        // add x-ray attackers behind the piece that just captured 
+        if (type == PieceP || type == PieceB || type == PieceQ) 
+        {
+            attackers |= BAttacks(to, occ) & allBQ; 
+        }
+        if (type == PieceR || type == PieceQ) 
+        {
+            attackers |= RAttacks(to, occ) & allRQ; 
+        }
+    }
+
+    return res; 
 }
 
 bool ValidateGame(const Game* g) 
@@ -584,6 +762,30 @@ bool ValidateGame(const Game* g)
         if (col[ColorB] != g->Colors[ColorB]) { printf("info string ERROR piece bitboards don't match accumulated black board\n"); valid = false; } 
     }
 
+    // incremental eval terms 
+    {
+        EvalState es; 
+        ComputeEvalState(g, &es); 
+        if (memcmp(&es, &g->Eval, sizeof(EvalState)) != 0) 
+        {
+            printf("info string ERROR eval terms are material %d mg %d eg %d but should be %d %d %d\n", 
+                g->Eval.Material, g->Eval.Mg, g->Eval.Eg, es.Material, es.Mg, es.Eg); 
+            valid = false; 
+        }
+    }
+
+    // network accumulators 
+    if (g->Acc) 
+    {
+        Accumulator acc; 
+        ComputeAccumulator(g, &acc); 
+        if (memcmp(&acc, &g->Acc[g->Depth], sizeof(Accumulator)) != 0) 
+        {
+            printf("info string ERROR network accumulators do not match the board\n"); 
+            valid = false; 
+        }
+    }
+
     // check 
     {
         Square ksq = LeastSigBit(g->Pieces[MakePiece(PieceK, g->Turn)]); 
@@ -694,6 +896,27 @@ bool ValidateGame(const Game* g)
             FindPrintHash(hash ^ g->Hash);  
             valid = false;  
         }
+
+        Zobrist pawnHash = 0; 
+        FOR_EACH_BIT(g->Pieces[PieceWP], { pawnHash ^= HashPawnSquare(sq, PieceWP); }); 
+        FOR_EACH_BIT(g->Pieces[PieceBP], { pawnHash ^= HashPawnSquare(sq, PieceBP); }); 
+
+        if (pawnHash != g->PawnHash) 
+        {
+            printf("info string ERROR pawn hash is invalid: "); 
+            PrintHashEnd(g->PawnHash, " instead of "); 
+            PrintHashEnd(pawnHash, "\n"); 
+            valid = false; 
+        }
+
+        Zobrist materialHash = HashMaterialCounts(g->Counts); 
+        if (materialHash != g->MaterialHash) 
+        {
+            printf("info string ERROR material hash is invalid: "); 
+            PrintHashEnd(g->MaterialHash, " instead of "); 
+            PrintHashEnd(materialHash, "\n"); 
+            valid = false; 
+        }
     }
 
     if (!valid) 
@@ -705,9 +928,9 @@ bool ValidateGame(const Game* g)
     return valid; 
 }
 
-static inline U64 PerftInternal(Game* g, MoveList* moves, int depth) 
+static inline U64 PerftInternal(Game* g, int depth) 
 {
-    U64 total = 0, start = moves->Size, size; 
+    U64 total = 0; 
 
     if (depth == 1) 
     {
@@ -717,20 +940,19 @@ static inline U64 PerftInternal(Game* g, MoveList* moves, int depth)
     }
     else if (depth > 1) 
     {
-        GenMoves(g, moves); 
-        size = moves->Size; 
+        MoveList moves; 
+        ClearMoves(&moves); 
+        GenMoves(g, &moves); 
 
         // PrintGame(g); 
 
-        for (U64 i = start; i < size; i++) 
+        for (U64 i = 0; i < moves.Size; i++) 
         {
-            Move mv = moves->Moves[i]; 
+            Move mv = moves.Moves[i].Mv; 
             PushMove(g, mv); 
-            total += PerftInternal(g, moves, depth - 1); 
+            total += PerftInternal(g, depth - 1); 
             PopMove(g, mv); 
         }
-
-        PopMovesToSize(moves, size); 
     }
     else 
     {
@@ -740,13 +962,221 @@ static inline U64 PerftInternal(Game* g, MoveList* moves, int depth)
     return total; 
 }
 
-U64 Perft(Game* g, int depth) 
+/**
+ * Counts leaves like PerftInternal, but looks up and stores subtree 
+ * counts in a cache. 
+ * 
+ * @param g The game 
+ * @param depth Remaining depth 
+ * @param cache The cache 
+ * @param probes Incremented for each lookup 
+ * @param hits Incremented for each successful lookup 
+ * @return Number of leaves 
+ */
+static U64 HashedPerftInternal(Game* g, int depth, PerftCache* cache, U64* probes, U64* hits) 
 {
-    MoveList* moves = NewMoveList(); 
+    // counting the moves is cheaper than a lookup 
+    if (depth < 2) return PerftInternal(g, depth); 
+
+    U64 total; 
+    (*probes)++; 
+    if (FindPerftCount(cache, g->Hash, depth, &total)) 
+    {
+        (*hits)++; 
+        return total; 
+    }
 
-    U64 total = PerftInternal(g, moves, depth); 
+    total = 0; 
+    MoveList moves; 
+    ClearMoves(&moves); 
+    GenMoves(g, &moves); 
+
+    for (U64 i = 0; i < moves.Size; i++) 
+    {
+        Move mv = moves.Moves[i].Mv; 
+        PushMove(g, mv); 
+        total += HashedPerftInternal(g, depth - 1, cache, probes, hits); 
+        PopMove(g, mv); 
+    }
+
+    StorePerftCount(cache, g->Hash, depth, total); 
+
+    return total; 
+}
+
+U64 Perft(Game* g, int depth) 
+{
+    U64 total = PerftInternal(g, depth); 
     printf("Depth: %d, Total: %" PRIu64 "", depth, total); 
 
-    FreeMoveList(moves); 
     return total; 
 }
+
+/**
+ * Subtrees per thread needed before perft splits after two moves. 
+ */
+#define PerftTasksPerThread 8 
+
+/**
+ * Subtree of a parallel perft. 
+ */
+typedef struct PerftTask PerftTask; 
+
+/**
+ * Data shared by all parallel perft threads. 
+ */
+typedef struct PerftWork PerftWork; 
+
+struct PerftTask 
+{
+    int Root; // index of the root move 
+    Move Reply; // second move, or NoMove if the subtree starts after the root move 
+};
+
+struct PerftWork 
+{
+    const Game* Root; 
+    const PerftResult* Result; 
+    const PerftTask* Tasks; 
+    int NumTasks; 
+    int Depth; // depth remaining below each subtree 
+    PerftCache* Cache; 
+    atomic_int Next; 
+    atomic_ullong Counts[MaxMovesPerTurn]; 
+    atomic_ullong CacheProbes; 
+    atomic_ullong CacheHits; 
+};
+
+/**
+ * Runs subtrees from the shared queue until it is empty. 
+ * 
+ * @param arg The shared work 
+ * @return NULL 
+ */
+static void* PerftWorker(void* arg) 
+{
+    PerftWork* work = arg; 
+
+    Game* g = NewGame(); 
+    CopyGame(g, work->Root); 
+    U64 probes = 0, hits = 0; 
+
+    int i; 
+    while ((i = atomic_fetch_add(&work->Next, 1)) < work->NumTasks) 
+    {
+        const PerftTask* task = &work->Tasks[i]; 
+        Move mv = work->Result->Moves[task->Root]; 
+
+        PushMove(g, mv); 
+        if (task->Reply != NoMove) PushMove(g, task->Reply); 
+
+        U64 total = work->Cache 
+                  ? HashedPerftInternal(g, work->Depth, work->Cache, &probes, &hits) 
+                  : PerftInternal(g, work->Depth); 
+        atomic_fetch_add(&work->Counts[task->Root], total); 
+
+        if (task->Reply != NoMove) PopMove(g, task->Reply); 
+        PopMove(g, mv); 
+    }
+
+    atomic_fetch_add(&work->CacheProbes, probes); 
+    atomic_fetch_add(&work->CacheHits, hits); 
+
+    FreeGame(g); 
+    return NULL; 
+}
+
+U64 ParallelPerft(const Game* g, int depth, int numThreads, PerftCache* cache, PerftResult* result) 
+{
+    result->Total = 0; 
+    result->NumMoves = 0; 
+    result->CacheProbes = 0; 
+    result->CacheHits = 0; 
+
+    if (depth <= 0) 
+    {
+        result->Total = 1; 
+        return result->Total; 
+    }
+
+    if (numThreads < 1) numThreads = 1; 
+
+    Game* root = NewGame(); 
+    CopyGame(root, g); 
+    MoveList moves; 
+    ClearMoves(&moves); 
+
+    GenMoves(root, &moves); 
+    result->NumMoves = (int) moves.Size; 
+    for (int i = 0; i < result->NumMoves; i++) 
+    {
+        result->Moves[i] = moves.Moves[i].Mv; 
+    }
+
+    // root moves alone are too few to balance many threads 
+    bool splitReplies = numThreads > 1 && depth >= 3 
+                     && result->NumMoves < numThreads * PerftTasksPerThread; 
+
+    PerftWork* work = malloc(sizeof(PerftWork)); 
+    PerftTask* tasks = malloc(sizeof(PerftTask) * MaxMovesPerTurn * (splitReplies ? MaxMovesPerTurn : 1)); 
+    int numTasks = 0; 
+
+    for (int i = 0; i < result->NumMoves; i++) 
+    {
+        if (!splitReplies) 
+        {
+            tasks[numTasks++] = (PerftTask) { i, NoMove }; 
+            continue; 
+        }
+
+        // a root move without replies has no leaves at this depth 
+        PushMove(root, result->Moves[i]); 
+        ClearMoves(&moves); 
+        GenMoves(root, &moves); 
+        for (U64 j = 0; j < moves.Size; j++) 
+        {
+            tasks[numTasks++] = (PerftTask) { i, moves.Moves[j].Mv }; 
+        }
+        PopMove(root, result->Moves[i]); 
+    }
+
+    work->Root = root; 
+    work->Result = result; 
+    work->Tasks = tasks; 
+    work->NumTasks = numTasks; 
+    work->Depth = depth - (splitReplies ? 2 : 1); 
+    work->Cache = cache; 
+    atomic_init(&work->Next, 0); 
+    atomic_init(&work->CacheProbes, 0); 
+    atomic_init(&work->CacheHits, 0); 
+    for (int i = 0; i < MaxMovesPerTurn; i++) 
+    {
+        atomic_init(&work->Counts[i], 0); 
+    }
+
+    // the calling thread works as well 
+    pthread_t* threads = malloc(sizeof(pthread_t) * numThreads); 
+    for (int t = 1; t < numThreads; t++) 
+    {
+        pthread_create(&threads[t], NULL, PerftWorker, work); 
+    }
+    PerftWorker(work); 
+    for (int t = 1; t < numThreads; t++) 
+    {
+        pthread_join(threads[t], NULL); 
+    }
+
+    for (int i = 0; i < result->NumMoves; i++) 
+    {
+        result->Counts[i] = atomic_load(&work->Counts[i]); 
+        result->Total += result->Counts[i]; 
+    }
+    result->CacheProbes = atomic_load(&work->CacheProbes); 
+    result->CacheHits = atomic_load(&work->CacheHits); 
+
+    free(threads); 
+    free(tasks); 
+    free(work); 
+    FreeGame(root); 
+    return result->Total; 
+}
@@ -23,6 +23,10 @@
 #include "Magic.h" 
 #include "Mailbox.h"
 #include "Move.h" 
+#include "Nnue.h" 
+#include "PawnTable.h" 
+#include "PerftCache.h" 
+#include "Pext.h" 
 #include "Piece.h"
 #include "Square.h"
 #include "Vector.h"
@@ -39,15 +43,37 @@ typedef struct Game Game;
 typedef struct MoveHist MoveHist; 
 
 /**
- * How deep to search for repeated positions.
+ * Evaluation terms that are updated incrementally as pieces move. 
  */
-#define DrawDepth 4
+typedef struct EvalState EvalState; 
+
+/**
+ * Cache of material evaluation terms (see Material.h). 
+ */
+typedef struct MaterialTable MaterialTable; 
+
+/**
+ * Plies without a capture or pawn move before the game is drawn. 
+ * Repeated positions are only searched for in these plies. 
+ */
+#define MaxHalfmoves 100 
 
 /**
  * Maximum depth to search.
  */
 #define MaxDepth 256 
 
+/**
+ * Number of positions kept in the move history: the reversible moves 
+ * before the search and the search itself, including quiescence search. 
+ */
+#define MaxHistory (MaxHalfmoves + MaxDepth * 2) 
+
+/**
+ * Maximum possible moves a color has in a legal position. 
+ */
+#define MaxMovesPerTurn 218 
+
 /**
  * Maximum possible score.
  */
@@ -63,18 +89,37 @@ typedef struct MoveHist MoveHist;
  */
 #define MaxFenLength 128 
 
+/**
+ * Game phase of the starting position. 
+ */
+#define MaxPhase 24 
+
+/**
+ * All scores are from white's perspective. 
+ */
+struct EvalState 
+{
+    int Material; 
+    int Mg; // middlegame piece-square 
+    int Eg; // endgame piece-square 
+};
+
 struct MoveHist 
 {
     int Halfmove; 
+    int PliesFromNull; 
     Square EnPassant; 
     CastleFlags Castle; 
     bool InCheck;
     Zobrist Hash; 
+    Zobrist PawnHash; 
+    Zobrist MaterialHash; 
+    EvalState Eval; 
 };
 
 struct Game 
 {
-    MoveHist Hist[MaxDepth + DrawDepth*2]; 
+    MoveHist Hist[MaxHistory]; 
 
     Mailbox Board; 
 
@@ -85,14 +130,19 @@ struct Game
     int Counts[NumPieces + 1]; 
 
     Zobrist Hash; 
+    Zobrist PawnHash; // only includes pawns 
+    Zobrist MaterialHash; // only includes piece counts 
     CastleFlags Castle; 
     Square EnPassant; 
+    EvalState Eval; 
 
     int Ply; 
     int Halfmove; 
+    int PliesFromNull; // plies since the last null move 
     Color Turn; 
     bool InCheck; 
     int Depth; 
+    Accumulator* Acc; // network accumulators by depth, NULL unless the game is evaluated with the network 
 
     U64 Nodes; 
 };
@@ -210,6 +260,40 @@ void PrintGame(const Game* g);
  */
 U64 Perft(Game* g, int depth); 
 
+/**
+ * Leaf counts of a perft run, split by root move. 
+ */
+typedef struct PerftResult PerftResult; 
+
+struct PerftResult 
+{
+    U64 Total; 
+    int NumMoves; 
+    Move Moves[MaxMovesPerTurn]; 
+    U64 Counts[MaxMovesPerTurn]; 
+    U64 CacheProbes; 
+    U64 CacheHits; 
+};
+
+/**
+ * Runs perft with the work split across threads. Each thread owns a copy 
+ * of the game and takes subtrees from a shared queue. Subtrees start after 
+ * two moves when that gives enough work to keep all threads busy, 
+ * otherwise after one move. 
+ * 
+ * With a cache, the leaf counts of positions with at least 2 plies left 
+ * are stored and reused when the position is reached again. The cache can 
+ * be kept between calls. 
+ * 
+ * @param g The game 
+ * @param depth Depth to run perft 
+ * @param numThreads Number of threads (at least 1) 
+ * @param cache Perft transposition cache (or NULL) 
+ * @param result Output leaf counts 
+ * @return Total number of leaf nodes 
+ */
+U64 ParallelPerft(const Game* g, int depth, int numThreads, PerftCache* cache, PerftResult* result); 
+
 /**
  * Checks for various draw conditions: 
  * - 50-move rule 
@@ -223,10 +307,36 @@ U64 Perft(Game* g, int depth);
  */
 bool IsSpecialDraw(const Game* g);
 
+/**
+ * Checks if the side to move has a reversible move that repeats a 
+ * position from the search, so it can at least force a draw. 
+ * Only finds repetitions that are inside the search tree. 
+ * 
+ * @param g The game 
+ * @param ply Number of plies since the search root 
+ * @return True if a move repeats an earlier position 
+ */
+bool HasUpcomingRepetition(const Game* g, int ply); 
+
+/**
+ * Static exchange evaluation: checks if a move wins at least some material 
+ * when both sides keep capturing on the target square with their least 
+ * valuable attacker. X-ray attackers behind each capturing piece are 
+ * included. Pins are ignored. 
+ * 
+ * @param g The game 
+ * @param mv The move 
+ * @param threshold Material balance to test for 
+ * @return True if the exchange is worth at least `threshold` 
+ */
+bool SeeAtLeast(const Game* g, Move mv, int threshold); 
+
 /**
  * Gets static evaluation for the current game state. 
  * 
  * @param g The game 
+ * @param pawns Pawn table to cache pawn structure terms (or NULL) 
+ * @param materials Material table to cache material terms (or NULL) 
  * @param ply What ply from the position the search started in 
  * @param nMoves Number of available moves for the current player 
  * @param draw Is the game a draw 
@@ -234,23 +344,68 @@ bool IsSpecialDraw(const Game* g);
  * @param verbose Should eval be printed to stdout
  * @return Static evaluation
  */
-int EvaluateVerbose(const Game* g, int ply, int nMoves, bool draw, int contempt, bool verbose); 
+int EvaluateVerbose(const Game* g, PawnTable* pawns, MaterialTable* materials, int ply, int nMoves, bool draw, int contempt, bool verbose); 
 
 /**
  * Gets static evaluation for the current game state. 
  * 
  * @param g The game 
+ * @param pawns Pawn table to cache pawn structure terms (or NULL) 
+ * @param materials Material table to cache material terms (or NULL) 
  * @param ply What ply from the position the search started in 
  * @param nMoves Number of available moves for the current player 
  * @param draw Is the game a draw 
  * @param contempt Contempt factor 
  * @return Static evaluation
  */
-static inline int Evaluate(const Game* g, int ply, int nMoves, bool draw, int contempt) 
+static inline int Evaluate(const Game* g, PawnTable* pawns, MaterialTable* materials, int ply, int nMoves, bool draw, int contempt) 
 {
-    return EvaluateVerbose(g, ply, nMoves, draw, contempt, false); 
+    return EvaluateVerbose(g, pawns, materials, ply, nMoves, draw, contempt, false); 
 } 
 
+/**
+ * Gets the network evaluation for the current game state. 
+ * The network must be loaded and the accumulator must be up to date. 
+ * 
+ * @param g The game 
+ * @return Network evaluation (from white's perspective) 
+ */
+int EvaluateNnue(const Game* g); 
+
+/**
+ * Computes network accumulators from scratch. 
+ * 
+ * @param g The game 
+ * @param acc Output for the accumulators 
+ */
+void ComputeAccumulator(const Game* g, Accumulator* acc); 
+
+/**
+ * Computes the accumulators of the current position from scratch, 
+ * allocating the accumulator stack if needed. Games only keep their 
+ * accumulators updated once this has been called, so it must be called 
+ * before a game is evaluated with the network. 
+ * 
+ * @param g The game 
+ */
+void RefreshAccumulator(Game* g); 
+
+/**
+ * Frees the accumulator stack of a game that is no longer evaluated with 
+ * the network. 
+ * 
+ * @param g The game 
+ */
+void ReleaseAccumulator(Game* g); 
+
+/**
+ * Updates the accumulators for a move that is about to be made. 
+ * 
+ * @param g The game (before the move) 
+ * @param mv The move 
+ */
+void PushAccumulator(Game* g, Move mv); 
+
 /**
  * Checks game state to make sure everything is consistent and correct. 
  * 
@@ -292,14 +447,15 @@ static inline bool EitherSideKP(const Game* g)
 }
 
 /**
- * Removes move history to increase max depth. 
+ * Removes move history to increase max depth. Positions since the last 
+ * capture or pawn move are kept for repetition detection. 
  * Do not use PopMove on previous moves after calling this. 
  * 
  * @param g The game
  */
 static inline void ClearDepth(Game* g) 
 {
-    int copyAmt = DrawDepth * 2; 
+    int copyAmt = g->Halfmove < MaxHalfmoves ? g->Halfmove : MaxHalfmoves; 
     if (g->Depth < copyAmt) copyAmt = g->Depth; 
 
     if (copyAmt > 0) 
@@ -312,6 +468,9 @@ static inline void ClearDepth(Game* g)
         }
     }
 
+    // the accumulator of the current position moves with it 
+    if (g->Acc) g->Acc[copyAmt] = g->Acc[g->Depth]; 
+
     g->Depth = copyAmt; 
 }
 
@@ -325,7 +484,11 @@ static inline void ClearDepth(Game* g)
  */
 static inline Bitboard RAttacks(Square sq, Bitboard occ) 
 {
+#ifdef BMI2
+    return PextRSlide[PextROffset[sq] + _pext_u64(occ, MagicRMask[sq])]; 
+#else
     return MagicRSlide[sq][((MagicRMask[sq] & occ) * MagicR[sq]) >> MagicRShift[sq]];
+#endif
 }
 
 /**
@@ -338,7 +501,11 @@ static inline Bitboard RAttacks(Square sq, Bitboard occ)
  */
 static inline Bitboard BAttacks(Square sq, Bitboard occ) 
 {
+#ifdef BMI2
+    return PextBSlide[PextBOffset[sq] + _pext_u64(occ, MagicBMask[sq])]; 
+#else
     return MagicBSlide[sq][((MagicBMask[sq] & occ) * MagicB[sq]) >> MagicBShift[sq]];
+#endif
 }
 
 /**
@@ -347,9 +514,10 @@ static inline Bitboard BAttacks(Square sq, Bitboard occ)
  * @param g The game 
  * @param region The region of the board to check 
  * @param chkCol Friendly color 
+ * @param oppPawnAttacks Squares attacked by enemy pawns 
  * @return How strongly the region is threatened weighted by piece type
  */
-static inline int GetAttackUnits(const Game* g, Bitboard region, Color chkCol) 
+static inline int GetAttackUnits(const Game* g, Bitboard region, Color chkCol, Bitboard oppPawnAttacks) 
 {
     Color col = chkCol; 
     Color opp = OppositeColor(col); 
@@ -358,16 +526,7 @@ static inline int GetAttackUnits(const Game* g, Bitboard region, Color chkCol)
 
     int units = 0; 
 
-    Bitboard pawns = g->Pieces[MakePiece(PieceP, opp)];  
-    if (opp == ColorW) 
-    {
-        pawns = ShiftNW(pawns) | ShiftNE(pawns); 
-    }
-    else 
-    {
-        pawns = ShiftSW(pawns) | ShiftSE(pawns); 
-    }
-    units += PopCount(pawns & region); 
+    units += PopCount(oppPawnAttacks & region); 
 
     FOR_EACH_BIT(g->Pieces[MakePiece(PieceN, opp)], 
     {
@@ -439,6 +598,30 @@ static inline bool IsAttacked(const Game* g, Square sq, Color chkCol)
     return GetAttackers(g, sq, chkCol) != 0; 
 }
 
+/**
+ * Finds all pieces of both colors that attack a square, using a custom 
+ * occupancy so that sliders behind removed pieces are found. 
+ * 
+ * @param g The game 
+ * @param sq Square to find attackers of 
+ * @param occ Pieces that are still on the board 
+ * @return Bitboard highlighting all attackers 
+ */
+static inline Bitboard GetAllAttackers(const Game* g, Square sq, Bitboard occ) 
+{
+    Bitboard allRQ = g->Pieces[PieceWR] | g->Pieces[PieceBR] | g->Pieces[PieceWQ] | g->Pieces[PieceBQ]; 
+    Bitboard allBQ = g->Pieces[PieceWB] | g->Pieces[PieceBB] | g->Pieces[PieceWQ] | g->Pieces[PieceBQ]; 
+
+    Bitboard att = (RAttacks(sq, occ) & allRQ) 
+                 | (BAttacks(sq, occ) & allBQ) 
+                 | ((g->Pieces[PieceWK] | g->Pieces[PieceBK]) & MovesK[sq]) 
+                 | ((g->Pieces[PieceWN] | g->Pieces[PieceBN]) & MovesN[sq]) 
+                 | (g->Pieces[PieceWP] & AttacksP[ColorB][sq]) 
+                 | (g->Pieces[PieceBP] & AttacksP[ColorW][sq]); 
+
+    return att & occ; 
+}
+
 /**
  * Bonus based on a passed pawn's rank. 
  */
@@ -481,6 +664,47 @@ extern int PieceTypeValues[5];
  */
 extern int BishopPair; 
 
+/**
+ * How much each piece type counts towards the game phase. 
+ */
+extern const int PhaseValues[NumPieceTypes]; 
+
+/**
+ * Adds or removes a piece from the incremental evaluation terms. 
+ * 
+ * @param es Evaluation terms 
+ * @param pc The piece 
+ * @param sq Square of the piece 
+ * @param sign 1 to add the piece, -1 to remove it 
+ */
+static inline void UpdateEvalState(EvalState* es, Piece pc, Square sq, int sign) 
+{
+    PieceType type = TypeOfPiece(pc); 
+
+    // piece-square tables are from black's perspective 
+    if (ColorOfPiece(pc) == ColorW) 
+    {
+        sq = FlipRank(sq); 
+    }
+    else 
+    {
+        sign = -sign; 
+    }
+
+    if (type != PieceK) es->Material += sign * PieceTypeValues[type]; 
+    es->Mg += sign * PieceSquare[0][type][sq]; 
+    es->Eg += sign * PieceSquare[1][type][sq]; 
+}
+
+/**
+ * Computes incremental evaluation terms from scratch. This must be called 
+ * after evaluation parameters change. 
+ * 
+ * @param g The game 
+ * @param es Output for the evaluation terms 
+ */
+void ComputeEvalState(const Game* g, EvalState* es); 
+
 /**
  * Maximum length of a parameter name. 
  */
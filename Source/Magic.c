@@ -10,7 +10,7 @@
 
 #include "Magic.h" 
 
-const Bitboard MagicRShift[64] = 
+const U8 MagicRShift[64] = 
 {
     52, 53, 53, 53, 53, 53, 53, 52, 
     53, 54, 54, 54, 54, 54, 54, 53, 
@@ -13114,7 +13114,7 @@ const Bitboard* MagicRSlide[64] =
     MagicR56Slide, MagicR57Slide, MagicR58Slide, MagicR59Slide, MagicR60Slide, MagicR61Slide, MagicR62Slide, MagicR63Slide, 
 };
 
-const Bitboard MagicBShift[64] = 
+const U8 MagicBShift[64] = 
 {
     57, 58, 58, 58, 58, 58, 58, 57, 
     58, 58, 58, 58, 58, 58, 58, 58, 
@@ -12,8 +12,8 @@
 
 #include "Bitboard.h" 
 
-extern const Bitboard MagicRShift[NumSquares]; 
-extern const Bitboard MagicBShift[NumSquares]; 
+extern const U8 MagicRShift[NumSquares]; 
+extern const U8 MagicBShift[NumSquares]; 
 
 extern const Bitboard MagicRMask[NumSquares]; 
 extern const Bitboard MagicBMask[NumSquares]; 
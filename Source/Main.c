@@ -15,6 +15,7 @@
 #include <string.h> 
 #include <pthread.h> 
 
+#include "Bench.h" 
 #include "Bitboard.h" 
 #include "Castle.h"
 #include "Game.h" 
@@ -30,12 +31,26 @@
     #define ENGINE_NAME "Halcyon"
 #endif 
 
+// instruction set level this copy of the engine is compiled for 
+#ifndef ENGINE_ISA 
+    #define ENGINE_ISA "generic" 
+#endif 
+
+// with runtime dispatch, every level has its own entry point (see Dispatch.c) 
+#ifndef ENGINE_MAIN 
+    #define ENGINE_MAIN main 
+#endif 
+
 #define MaxUciInput 4096
 
 #define MinUciTT 1 
 #define MaxUciTT 16384
 #define DefaultUciTT 16
 
+#define MinUciThreads 1 
+#define MaxUciThreads MaxSearchThreads 
+#define DefaultUciThreads 1 
+
 #define MinUciContempt -1000
 #define MaxUciContempt  1000
 #define DefaultUciContempt  0
@@ -72,10 +87,13 @@ bool UciEquals(const char* a, const char* b)
  */
 bool UciCommandUci(void) 
 {
-    printf("id name %s\n", ENGINE_NAME); 
+    printf("id name %s (%s)\n", ENGINE_NAME, ENGINE_ISA); 
     printf("id author Nicholas Hamilton\n"); 
     printf("option name Hash type spin default %d min %d max %d\n", DefaultUciTT, MinUciTT, MaxUciTT); 
+    printf("option name Threads type spin default %d min %d max %d\n", DefaultUciThreads, MinUciThreads, MaxUciThreads); 
     printf("option name Contempt type spin default %d min %d max %d\n", DefaultUciContempt, MinUciContempt, MaxUciContempt); 
+    printf("option name UseNNUE type check default false\n"); 
+    printf("option name EvalFile type string default <empty>\n"); 
     printf("uciok\n"); 
     return true; 
 }
@@ -222,7 +240,7 @@ bool UciCommandPosition(void)
             bool found = false; 
             for (U64 i = 0; i < moves->Size; i++) 
             {
-                Move m = moves->Moves[i]; 
+                Move m = moves->Moves[i].Mv; 
                 if (FromSquare(m) == from && ToSquare(m) == to && PromotionPiece(m) == promote) 
                 {
                     found = true; 
@@ -273,7 +291,9 @@ bool UciCommandGo(void)
     int moveTime = InfTime; 
     int wTime = InfTime, bTime = InfTime, sideTime = InfTime; 
     int wIncr = 0, bIncr = 0, sideIncr = 0; 
+    int movesToGo = 0; 
     int perftNum = -1; 
+    int perftCacheMb = 0; 
 
     while ((token = UciNextToken())) 
     {
@@ -313,42 +333,51 @@ bool UciCommandGo(void)
             bIncr = atoi(token); 
             if (UciGame->Turn == ColorB) sideIncr = bIncr; 
         }
+        if (UciEquals(token, "movestogo") && (token = UciNextToken())) 
+        {
+            movesToGo = atoi(token); 
+        }
         if (UciEquals(token, "perft") && (token = UciNextToken())) 
         {
             perftNum = atoi(token); 
         }
+        // not part of UCI: MiB of perft transposition cache 
+        if (UciEquals(token, "cache") && (token = UciNextToken())) 
+        {
+            perftCacheMb = atoi(token); 
+        }
     }
 
     if (perftNum > 0) 
     {
-        U64 total = 0; 
+        PerftResult* result = malloc(sizeof(PerftResult)); 
 
-        Game* pGame = NewGame(); 
-        CopyGame(pGame, UciGame); 
-        MoveList* moves = NewMoveList(); 
+        PerftCache cache; 
+        if (perftCacheMb > 0) CreatePerftCache(&cache, perftCacheMb); 
 
-        clock_t start = clock(); 
+        // wall time, since perft uses the search threads 
+        TimePoint start = GetTimeMs(); 
+        U64 total = ParallelPerft(UciGame, perftNum, UciEngine.NumThreads, perftCacheMb > 0 ? &cache : NULL, result); 
+        TimePoint end = GetTimeMs(); 
 
-        GenMoves(UciGame, moves); 
-        for (U64 i = 0; i < moves->Size; i++) 
+        for (int i = 0; i < result->NumMoves; i++) 
         {
-            Move mv = moves->Moves[i]; 
-            PrintMoveEnd(mv, " - "); 
-            PushMove(UciGame, mv); 
-            total += Perft(UciGame, perftNum - 1); 
-            PopMove(UciGame, mv); 
-            printf("\n"); 
+            PrintMoveEnd(result->Moves[i], " - "); 
+            printf("Depth: %d, Total: %" PRIu64 "\n", perftNum - 1, result->Counts[i]); 
         }
+        printf("Total: %" PRIu64 "", total); 
 
-        clock_t end = clock(); 
-        printf("Total: %lu", total); 
-
-        FreeMoveList(moves); 
-        FreeGame(pGame); 
-
-        double dur = (double) (end - start) / CLOCKS_PER_SEC; 
+        double dur = (double) (end > start ? end - start : 1) / 1000; 
         double nps = total / dur; 
-        printf(", Time: %0.2fs, Speed: %0.3fMnps\n", dur, nps / 1000000.0); 
+        printf(", Time: %0.2fs, Speed: %0.3fMnps", dur, nps / 1000000.0); 
+        if (perftCacheMb > 0) 
+        {
+            printf(", Cache hits: %0.1f%%", 100.0 * result->CacheHits / (result->CacheProbes ? result->CacheProbes : 1)); 
+            DestroyPerftCache(&cache); 
+        }
+        printf("\n"); 
+
+        free(result); 
         return true; 
     }
 
@@ -361,19 +390,6 @@ bool UciCommandGo(void)
         printf("info string Searching with no depth\n"); 
     }
 
-    if (sideTime > InfTime) 
-    {
-        int totalTime = sideTime - 2000; 
-        if (totalTime < 40) totalTime = 40; 
-
-        int tgtTime = (int) (totalTime / 40 + sideIncr * 3 / 4); 
-        if (tgtTime <= 0) tgtTime = 1; 
-         
-        timeMs = tgtTime; 
-        printf("info string Using %dms out of %dms to think\n", timeMs, sideTime); 
-        fflush(stdout); 
-    }
-
     if (moveTime > 0) 
     {
         timeMs = moveTime; 
@@ -383,6 +399,12 @@ bool UciCommandGo(void)
     {
         printf("info string Searching with max time of %dms\n", timeMs); 
     }
+    else if (sideTime > InfTime) 
+    {
+        printf("info string Searching with %dms+%dms on the clock", sideTime, sideIncr); 
+        if (movesToGo > 0) printf(" for %d moves", movesToGo); 
+        printf("\n"); 
+    }
     else 
     {
         printf("info string Searching with no time limit\n"); 
@@ -391,6 +413,7 @@ bool UciCommandGo(void)
 
     SearchParams params; 
     InitSearchParams(&params, UciGame, depth, timeMs); 
+    SetSearchParamsClock(&params, sideTime, sideIncr, movesToGo); 
 
     Search(&UciEngine, &params); 
     return true; 
@@ -429,11 +452,27 @@ bool UciCommandSetOption(void)
         if (value > MaxUciTT) value = MaxUciTT; 
         if (value < MinUciTT) value = MinUciTT; 
 
+        StopSearchContext(&UciEngine); 
         DestroyTTable(&UciEngine.Transpositions); 
         CreateTTable(&UciEngine.Transpositions, value); 
 
         return true; 
     }
+    else if (UciEquals(token, "Threads")) 
+    {
+        token = UciNextToken(); 
+        if (!UciEquals(token, "value")) return false; 
+        token = UciNextToken(); 
+        if (!token) return false; 
+
+        int value = atoi(token); 
+        if (value > MaxUciThreads) value = MaxUciThreads; 
+        if (value < MinUciThreads) value = MinUciThreads; 
+
+        SetSearchThreads(&UciEngine, value); 
+
+        return true; 
+    }
     else if (UciEquals(token, "Contempt")) 
     {
         token = UciNextToken(); 
@@ -449,6 +488,51 @@ bool UciCommandSetOption(void)
 
         return true; 
     }
+    else if (UciEquals(token, "UseNNUE")) 
+    {
+        token = UciNextToken(); 
+        if (!UciEquals(token, "value")) return false; 
+        token = UciNextToken(); 
+        if (!token) return false; 
+
+        bool value = UciEquals(token, "true"); 
+        if (value && !IsNetworkLoaded()) 
+        {
+            printf("info string No network loaded, set EvalFile first\n"); 
+            value = false; 
+        }
+
+        StopSearchContext(&UciEngine); 
+        UseNnue = value; 
+        if (UseNnue) RefreshAccumulator(UciGame); 
+        else ReleaseAccumulator(UciGame); 
+        ClearSearchEvals(&UciEngine); 
+
+        printf("info string Using %s evaluation\n", UseNnue ? "network" : "classical"); 
+        return true; 
+    }
+    else if (UciEquals(token, "EvalFile")) 
+    {
+        token = UciNextToken(); 
+        if (!UciEquals(token, "value")) return false; 
+
+        // the path is the rest of the line and may contain spaces 
+        token = strtok(NULL, "\n"); 
+        if (!token) return false; 
+
+        StopSearchContext(&UciEngine); 
+        if (!LoadNetwork(token)) 
+        {
+            printf("info string Could not load network from %s\n", token); 
+            return true; 
+        }
+
+        if (UseNnue) RefreshAccumulator(UciGame); 
+        ClearSearchEvals(&UciEngine); 
+
+        printf("info string Loaded network from %s\n", token); 
+        return true; 
+    }
 
     printf("Unknown option: %s\n", token); 
     return true; 
@@ -476,7 +560,7 @@ bool UciCommandEval(bool qsearch)
 
     bool draw = IsSpecialDraw(UciGame); 
 
-    EvaluateVerbose(UciGame, 0, info.NumMoves, draw, UciEngine.Contempt, true); 
+    EvaluateVerbose(UciGame, NULL, NULL, 0, info.NumMoves, draw, UciEngine.Contempt, true); 
 
     return true; 
 }
@@ -521,12 +605,46 @@ bool UciCommandSetTune(void)
         total++; 
     }
 
+    // material and piece-square values may have changed 
+    ComputeEvalState(UciGame, &UciGame->Eval); 
+    ClearSearchEvals(&UciEngine); 
+
     printf("info string Updated %d eval weights\n", total); 
     fflush(stdout); 
 
     return true; 
 }
 
+/**
+ * Runs the search benchmark. 
+ * 
+ * @return True 
+ */
+bool UciCommandBench(void) 
+{
+    // in case we were searching before this command 
+    StopSearchContext(&UciEngine); 
+
+    int depth = DefaultBenchDepth; 
+    int hash = DefaultBenchHash; 
+    int threads = DefaultBenchThreads; 
+
+    const char* token; 
+    if ((token = UciNextToken())) depth = atoi(token); 
+    if ((token = UciNextToken())) hash = atoi(token); 
+    if ((token = UciNextToken())) threads = atoi(token); 
+
+    if (depth < 1) depth = 1; 
+    if (depth > MaxDepth - 1) depth = MaxDepth - 1; 
+    if (hash < MinUciTT) hash = MinUciTT; 
+    if (hash > MaxUciTT) hash = MaxUciTT; 
+    if (threads < MinUciThreads) threads = MinUciThreads; 
+    if (threads > MaxUciThreads) threads = MaxUciThreads; 
+
+    RunBench(depth, hash, threads); 
+    return true; 
+}
+
 /**
  * Used to selfplay data generation. 
  * 
@@ -649,7 +767,7 @@ badParse:
         Search(&UciEngine, &params); 
         WaitForSearchContext(&UciEngine); 
 
-        Move mv = moves->Moves[NextU32(&r) % moves->Size]; 
+        Move mv = moves->Moves[NextU32(&r) % moves->Size].Mv; 
         if (g->Ply >= bestMovePly) 
         {
             mv = UciEngine.BestLine.Moves[0]; 
@@ -701,6 +819,7 @@ bool UciParse(const char* origCommand)
         if (UciEquals(token, "gettune")) return UciCommandGetTune(); 
         if (UciEquals(token, "settune")) return UciCommandSetTune(); 
         if (UciEquals(token, "datagen")) return UciCommandDataGen(); 
+        if (UciEquals(token, "bench")) return UciCommandBench(); 
     }
 
     return false; 
@@ -709,13 +828,20 @@ bool UciParse(const char* origCommand)
 /**
  * Entry point of the program. 
  * 
+ * If arguments are given they are run as a single command (for example 
+ * `bench 12`) and the program exits afterwards. 
+ * 
+ * @param argc Number of arguments 
+ * @param argv Arguments 
  * @return 0
  */
-int main(void) 
+int ENGINE_MAIN(int argc, char** argv) 
 {
-    printf("%s by Nicholas Hamilton\n", ENGINE_NAME); 
+    printf("%s (%s) by Nicholas Hamilton\n", ENGINE_NAME, ENGINE_ISA); 
     fflush(stdout); 
 
+    InitSliderTables(); 
+
     UciGame = NewGame(); 
     LoadFen(UciGame, StartFen); 
     CreateSearchContext(&UciEngine); 
@@ -725,6 +851,22 @@ int main(void)
     UciEngine.Contempt = DefaultUciContempt; 
 
     char input[MaxUciInput]; 
+    if (argc > 1) 
+    {
+        input[0] = '\0'; 
+        for (int i = 1; i < argc; i++) 
+        {
+            if (strlen(input) + strlen(argv[i]) + 2 > MaxUciInput) break; 
+            strcat(input, argv[i]); 
+            strcat(input, " "); 
+        }
+        if (!UciParse(input)) printf("Unknown command: '%s'\n", input); 
+
+        FreeGame(UciGame); 
+        DestroySearchContext(&UciEngine); 
+        return 0; 
+    }
+
     while (true) 
     {
         fflush(stdout); 
@@ -0,0 +1,370 @@
+/**
+ * @file Material.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Implements the material table and specialized endgame evaluation. 
+ */
+
+#include "Material.h" 
+
+#include <stdlib.h> 
+#include <string.h> 
+
+#include "Bitbase.h" 
+
+/**
+ * Piece values used to judge if a material advantage can win. 
+ */
+static const int MinorPoints = 3; 
+static const int RookPoints = 5; 
+static const int QueenPoints = 9; 
+
+/**
+ * Scale factors for a color without pawns and at most a minor piece ahead. 
+ */
+#define ScaleNoPawnsVsMinor 4 
+#define ScaleNoPawns 14 
+
+/**
+ * Scale factor for a color with one pawn and at most a minor piece ahead. 
+ */
+#define ScaleOnePawn 48 
+
+/**
+ * Scale factors for opposite-colored bishops with only pawns, when up at 
+ * most one pawn and when up more. 
+ */
+#define ScaleOppBishops 16 
+#define ScaleOppBishopsPawns 32 
+
+/**
+ * @param counts Number of pieces of each type 
+ * @param col Color to count 
+ * @return Value of pieces (not pawns) in points 
+ */
+static inline int GetPiecePoints(const int* counts, Color col) 
+{
+    return MinorPoints * (counts[MakePiece(PieceN, col)] + counts[MakePiece(PieceB, col)]) 
+         + RookPoints * counts[MakePiece(PieceR, col)] 
+         + QueenPoints * counts[MakePiece(PieceQ, col)]; 
+}
+
+/**
+ * Finds the specialized endgame for a material configuration. 
+ * 
+ * @param counts Number of pieces of each type 
+ * @param col Color that would be winning 
+ * @return The endgame type 
+ */
+static EndgameType GetEndgameType(const int* counts, Color col) 
+{
+    Color opp = OppositeColor(col); 
+
+    int p = counts[MakePiece(PieceP, col)]; 
+    int n = counts[MakePiece(PieceN, col)]; 
+    int b = counts[MakePiece(PieceB, col)]; 
+    int r = counts[MakePiece(PieceR, col)]; 
+    int q = counts[MakePiece(PieceQ, col)]; 
+
+    int oppP = counts[MakePiece(PieceP, opp)]; 
+    int oppPieces = GetPiecePoints(counts, opp); 
+
+    if (oppP == 0 && oppPieces == 0) 
+    {
+        if (p == 0 && n == 1 && b == 1 && r == 0 && q == 0) return EndgameKBNK; 
+        if (p == 1 && n == 0 && b == 0 && r == 0 && q == 0) return EndgameKPK; 
+        if (q > 0 || r > 0 || b >= 2 || (b > 0 && n > 0)) return EndgameKXK; 
+    }
+
+    if (oppP == 1 && oppPieces == 0 && p == 0 && n == 0 && b == 0 && r == 1 && q == 0) 
+    {
+        return EndgameKRKP; 
+    }
+
+    return EndgameNone; 
+}
+
+/**
+ * Computes the scale factor for a color that is ahead. 
+ * 
+ * @param counts Number of pieces of each type 
+ * @param col Color that is ahead 
+ * @return Scale factor out of ScaleNormal 
+ */
+static int GetMaterialScale(const int* counts, Color col) 
+{
+    Color opp = OppositeColor(col); 
+
+    int pawns = counts[MakePiece(PieceP, col)]; 
+    int pieces = GetPiecePoints(counts, col); 
+    int oppPieces = GetPiecePoints(counts, opp); 
+
+    // two knights cannot force mate against a lone king 
+    if (pawns == 0 && pieces == 2 * MinorPoints && counts[MakePiece(PieceN, col)] == 2 
+     && oppPieces == 0 && counts[MakePiece(PieceP, opp)] == 0) 
+    {
+        return 0; 
+    }
+
+    // without pawns, at least a rook more is needed to win 
+    if (pawns == 0 && pieces - oppPieces <= MinorPoints) 
+    {
+        if (pieces < RookPoints) return 0; 
+        return oppPieces <= MinorPoints ? ScaleNoPawnsVsMinor : ScaleNoPawns; 
+    }
+
+    if (pawns == 1 && pieces - oppPieces <= MinorPoints) 
+    {
+        return ScaleOnePawn; 
+    }
+
+    return ScaleNormal; 
+}
+
+void ComputeMaterialEntry(const int* counts, MaterialEntry* entry) 
+{
+    int phase = 0; 
+    for (Piece pc = 0; pc < NumPieces; pc++) 
+    {
+        phase += PhaseValues[TypeOfPiece(pc)] * counts[pc]; 
+    }
+
+    // between 0 and 24, extra material from promotions is ignored 
+    phase = MaxPhase - phase; 
+    entry->Phase = (U8) ((phase >= 0) * phase); 
+
+    entry->Imbalance = (S16) (BishopPair * ((counts[PieceWB] >= 2) - (counts[PieceBB] >= 2))); 
+
+    entry->Flags = 0; 
+    entry->Endgame = EndgameNone; 
+    entry->Strong = ColorW; 
+
+    for (Color col = ColorW; col <= ColorB; col++) 
+    {
+        entry->Scale[col] = (U8) GetMaterialScale(counts, col); 
+
+        EndgameType type = GetEndgameType(counts, col); 
+        if (type != EndgameNone) 
+        {
+            entry->Endgame = (U8) type; 
+            entry->Strong = (U8) col; 
+        }
+    }
+
+    int wPieces = GetPiecePoints(counts, ColorW), bPieces = GetPiecePoints(counts, ColorB); 
+
+    if (IsMaterialDraw(counts)) 
+    {
+        entry->Flags |= MaterialDraw; 
+    }
+
+    if (counts[PieceWB] == 1 && counts[PieceBB] == 1 && wPieces == MinorPoints && bPieces == MinorPoints) 
+    {
+        entry->Flags |= MaterialOppBishops; 
+    }
+}
+
+void CreateMaterialTable(MaterialTable* mt) 
+{
+    // the key of an empty entry is 0, which no position has in practice 
+    mt->Entries = calloc(MaterialTableSize, sizeof(MaterialEntry)); 
+}
+
+void DestroyMaterialTable(MaterialTable* mt) 
+{
+    free(mt->Entries); 
+}
+
+void ClearMaterialTable(MaterialTable* mt) 
+{
+    memset(mt->Entries, 0, MaterialTableSize * sizeof(MaterialEntry)); 
+}
+
+/**
+ * @param sq A square 
+ * @return Bonus for being close to the edge of the board 
+ */
+static inline int PushToEdge(Square sq) 
+{
+    int file = GetFile(sq), rank = GetRank(sq); 
+    int fileDist = file < 4 ? file : 7 - file; 
+    int rankDist = rank < 4 ? rank : 7 - rank; 
+
+    return 20 * (6 - fileDist - rankDist); 
+}
+
+/**
+ * @param a A square 
+ * @param b Another square 
+ * @return Bonus for two squares being close to each other 
+ */
+static inline int PushClose(Square a, Square b) 
+{
+    return 10 * (7 - GetDistance(a, b)); 
+}
+
+/**
+ * Evaluates mating material against a lone king. The lone king is driven 
+ * to the edge of the board. 
+ * 
+ * @param g The game 
+ * @param strong Color with the material 
+ * @return Evaluation for the strong color 
+ */
+static int EvalKXK(const Game* g, Color strong) 
+{
+    Square strongK = LeastSigBit(g->Pieces[MakePiece(PieceK, strong)]); 
+    Square weakK = LeastSigBit(g->Pieces[MakePiece(PieceK, OppositeColor(strong))]); 
+
+    return KnownWinValue + ColorSign(strong) * g->Eval.Material 
+         + PushToEdge(weakK) + PushClose(strongK, weakK); 
+}
+
+/**
+ * Evaluates bishop and knight against a lone king. Mate is only possible 
+ * in a corner of the bishop's color. 
+ * 
+ * @param g The game 
+ * @param strong Color with the bishop and knight 
+ * @return Evaluation for the strong color 
+ */
+static int EvalKBNK(const Game* g, Color strong) 
+{
+    Square strongK = LeastSigBit(g->Pieces[MakePiece(PieceK, strong)]); 
+    Square weakK = LeastSigBit(g->Pieces[MakePiece(PieceK, OppositeColor(strong))]); 
+
+    bool light = (g->Pieces[MakePiece(PieceB, strong)] & LightSquares) != 0; 
+    Square corner1 = light ? H1 : A1; 
+    Square corner2 = light ? A8 : H8; 
+    int cornerDist = GetDistance(weakK, corner1) < GetDistance(weakK, corner2) 
+                   ? GetDistance(weakK, corner1) : GetDistance(weakK, corner2); 
+
+    return KnownWinValue + ColorSign(strong) * g->Eval.Material 
+         + 40 * (7 - cornerDist) + PushClose(strongK, weakK); 
+}
+
+/**
+ * Evaluates king and pawn against king with the bitbase. 
+ * 
+ * @param g The game 
+ * @param strong Color with the pawn 
+ * @return Evaluation for the strong color 
+ */
+static int EvalKPK(const Game* g, Color strong) 
+{
+    Color weak = OppositeColor(strong); 
+    Square strongK = LeastSigBit(g->Pieces[MakePiece(PieceK, strong)]); 
+    Square weakK = LeastSigBit(g->Pieces[MakePiece(PieceK, weak)]); 
+    Square pawn = LeastSigBit(g->Pieces[MakePiece(PieceP, strong)]); 
+
+    if (!ProbeKPK(strong, strongK, weakK, pawn, g->Turn)) return 0; 
+
+    // advancing the pawn is progress towards promotion 
+    int rank = strong == ColorW ? GetRank(pawn) : 7 - GetRank(pawn); 
+    return KnownWinValue + PieceTypeValues[PieceP] + 10 * rank; 
+}
+
+/**
+ * Evaluates rook against pawn. The rook wins if its king stops the pawn or 
+ * the lone king is too far from the pawn, otherwise the pawn often draws. 
+ * 
+ * @param g The game 
+ * @param strong Color with the rook 
+ * @return Evaluation for the strong color 
+ */
+static int EvalKRKP(const Game* g, Color strong) 
+{
+    Color weak = OppositeColor(strong); 
+    Square strongK = LeastSigBit(g->Pieces[MakePiece(PieceK, strong)]); 
+    Square weakK = LeastSigBit(g->Pieces[MakePiece(PieceK, weak)]); 
+    Square rook = LeastSigBit(g->Pieces[MakePiece(PieceR, strong)]); 
+    Square pawn = LeastSigBit(g->Pieces[MakePiece(PieceP, weak)]); 
+
+    // squares are viewed as if the strong color is white, the pawn moves down 
+    if (strong == ColorB) 
+    {
+        strongK = FlipRank(strongK); 
+        weakK = FlipRank(weakK); 
+        rook = FlipRank(rook); 
+        pawn = FlipRank(pawn); 
+    }
+
+    Square promo = (Square) GetFile(pawn); 
+    Square push = (Square) (pawn - 8); 
+    int rookValue = PieceTypeValues[PieceR]; 
+
+    // the strong king is in front of the pawn 
+    if (GetFile(strongK) == GetFile(pawn) && GetRank(strongK) < GetRank(pawn)) 
+    {
+        return rookValue - GetDistance(strongK, pawn); 
+    }
+
+    // the weak king cannot protect the pawn in time 
+    if (GetDistance(weakK, pawn) >= 3 + (g->Turn == weak) && GetDistance(weakK, rook) >= 3) 
+    {
+        return rookValue - GetDistance(strongK, pawn); 
+    }
+
+    // the pawn is far advanced, protected and the strong king is far away 
+    if (GetRank(weakK) <= 2 && GetDistance(weakK, pawn) == 1 && GetRank(strongK) >= 3 
+     && GetDistance(strongK, pawn) > 2 + (g->Turn == strong)) 
+    {
+        return 80 - 8 * GetDistance(strongK, pawn); 
+    }
+
+    return 200 - 8 * (GetDistance(strongK, push) - GetDistance(weakK, push) - GetDistance(pawn, promo)); 
+}
+
+bool EvalEndgame(const Game* g, const MaterialEntry* entry, int* eval) 
+{
+    Color strong = (Color) entry->Strong; 
+    int score; 
+
+    switch (entry->Endgame) 
+    {
+        case EndgameKXK: 
+            score = EvalKXK(g, strong); 
+            break; 
+
+        case EndgameKBNK: 
+            score = EvalKBNK(g, strong); 
+            break; 
+
+        case EndgameKPK: 
+            score = EvalKPK(g, strong); 
+            break; 
+
+        case EndgameKRKP: 
+            score = EvalKRKP(g, strong); 
+            break; 
+
+        default: 
+            return false; 
+    }
+
+    *eval = ColorSign(strong) * score; 
+    return true; 
+}
+
+int GetScaleFactor(const Game* g, const MaterialEntry* entry, Color strong) 
+{
+    int scale = entry->Scale[strong]; 
+
+    if (entry->Flags & MaterialOppBishops) 
+    {
+        bool wLight = (g->Pieces[PieceWB] & LightSquares) != 0; 
+        bool bLight = (g->Pieces[PieceBB] & LightSquares) != 0; 
+
+        if (wLight != bLight) 
+        {
+            int diff = abs(g->Counts[PieceWP] - g->Counts[PieceBP]); 
+            int ocb = diff <= 1 ? ScaleOppBishops : ScaleOppBishopsPawns; 
+            if (ocb < scale) scale = ocb; 
+        }
+    }
+
+    return scale; 
+}
@@ -0,0 +1,177 @@
+/**
+ * @file Material.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Defines the material table and specialized endgame evaluation. 
+ * 
+ * Terms that only depend on piece counts are computed once per material 
+ * hash and stored in a small table. Each search thread has its own table, 
+ * so entries are written without any synchronization. 
+ */
+
+#pragma once 
+
+#include <stdbool.h> 
+
+#include "Game.h" 
+#include "Types.h" 
+#include "Zobrist.h" 
+
+/**
+ * Scale factor that leaves the evaluation unchanged. 
+ */
+#define ScaleNormal 64 
+
+/**
+ * Evaluation of an endgame that is known to be won, before the endgame 
+ * specific terms are added. It is far below mate scores. 
+ */
+#define KnownWinValue 10000 
+
+/**
+ * The material can never deliver mate. 
+ */
+#define MaterialDraw 1 
+
+/**
+ * Both sides have only a bishop and pawns, which is drawish if the bishops 
+ * are on opposite colors. 
+ */
+#define MaterialOppBishops 2 
+
+/**
+ * Number of entries in a material table (must be a power of two). 
+ */
+#define MaterialTableSize 8192 
+
+/**
+ * Endgames with their own evaluation function. 
+ */
+typedef enum EndgameType 
+{
+    EndgameNone, 
+    EndgameKXK, // mating material against a lone king 
+    EndgameKBNK, 
+    EndgameKPK, 
+    EndgameKRKP, 
+} EndgameType;
+
+/**
+ * Evaluation data of a material configuration. 
+ */
+typedef struct MaterialEntry MaterialEntry; 
+
+struct MaterialEntry 
+{
+    Zobrist Key; 
+    S16 Imbalance; // white minus black 
+    U8 Phase; // 0 (opening) to MaxPhase (endgame) 
+    U8 Scale[NumColors]; // used when that color is ahead, out of ScaleNormal 
+    U8 Endgame; // EndgameType 
+    U8 Strong; // color the endgame evaluation is for 
+    U8 Flags; 
+};
+
+/**
+ * Material hash table (declared in Game.h). 
+ */
+struct MaterialTable 
+{
+    MaterialEntry* Entries; 
+};
+
+/**
+ * Initializes an empty material table. 
+ * 
+ * @param mt The table 
+ */
+void CreateMaterialTable(MaterialTable* mt); 
+
+/**
+ * Deinitializes a material table. 
+ * 
+ * @param mt The table 
+ */
+void DestroyMaterialTable(MaterialTable* mt); 
+
+/**
+ * Removes all entries from a material table. This must be called when 
+ * evaluation parameters change. 
+ * 
+ * @param mt The table 
+ */
+void ClearMaterialTable(MaterialTable* mt); 
+
+/**
+ * Computes the material entry for a set of piece counts. 
+ * 
+ * @param counts Number of pieces of each type 
+ * @param entry Output entry (the key is not set) 
+ */
+void ComputeMaterialEntry(const int* counts, MaterialEntry* entry); 
+
+/**
+ * Gets the material entry of a position, computing it if it is not in 
+ * the table. 
+ * 
+ * @param mt Material table (or NULL) 
+ * @param g The game 
+ * @param local Storage for the entry if there is no table 
+ * @return The entry 
+ */
+static inline const MaterialEntry* ProbeMaterial(MaterialTable* mt, const Game* g, MaterialEntry* local) 
+{
+    MaterialEntry* entry = local; 
+
+    if (mt) 
+    {
+        entry = &mt->Entries[g->MaterialHash & (MaterialTableSize - 1)]; 
+        if (entry->Key == g->MaterialHash) return entry; 
+    }
+
+    ComputeMaterialEntry(g->Counts, entry); 
+    entry->Key = g->MaterialHash; 
+    return entry; 
+}
+
+/**
+ * Checks if neither color has enough material to deliver mate: a lone 
+ * king against a lone king or a single minor piece. 
+ * 
+ * @param counts Number of pieces of each type 
+ * @return True if the material is a draw 
+ */
+static inline bool IsMaterialDraw(const int* counts) 
+{
+    if (counts[PieceWP] || counts[PieceBP] || counts[PieceWR] || counts[PieceBR] || counts[PieceWQ] || counts[PieceBQ]) 
+    {
+        return false; 
+    }
+
+    int wMinors = counts[PieceWN] + counts[PieceWB]; 
+    int bMinors = counts[PieceBN] + counts[PieceBB]; 
+    return (wMinors == 0 && bMinors <= 1) || (bMinors == 0 && wMinors <= 1); 
+}
+
+/**
+ * Evaluates a position with a specialized endgame evaluation. 
+ * 
+ * @param g The game 
+ * @param entry Material entry of the position 
+ * @param eval Output evaluation (from white's perspective) 
+ * @return True if the endgame was evaluated, false to use the normal evaluation 
+ */
+bool EvalEndgame(const Game* g, const MaterialEntry* entry, int* eval); 
+
+/**
+ * Gets the scale factor for the evaluation of a position. 
+ * 
+ * @param g The game 
+ * @param entry Material entry of the position 
+ * @param strong Color that is ahead 
+ * @return Scale factor out of ScaleNormal 
+ */
+int GetScaleFactor(const Game* g, const MaterialEntry* entry, Color strong); 
@@ -276,6 +276,18 @@ static inline bool IsCheck(Move m)
     return (bool) ((m >> 29) & 1); 
 }
 
+/**
+ * Compares moves without the check flag. 
+ * 
+ * @param a First move 
+ * @param b Second move 
+ * @return True if both moves are the same 
+ */
+static inline bool IsSameMove(Move a, Move b) 
+{
+    return ((a ^ b) & ~((Move) 1 << 29)) == 0; 
+}
+
 /**
  * Should the move be considered for quiescence search. 
  * 
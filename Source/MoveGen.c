@@ -341,13 +341,23 @@ static inline void GenBRInfo(const Game* g, TARGET_SQUARE_PARAMS, MoveInfo* info
 static inline void GenWQInfo(const Game* g, TARGET_SQUARE_PARAMS, MoveInfo* info) { FN_GEN_Q_INFO(ColorW); } 
 static inline void GenBQInfo(const Game* g, TARGET_SQUARE_PARAMS, MoveInfo* info) { FN_GEN_Q_INFO(ColorB); } 
 
+/**
+ * Runs one step of move info generation. 
+ * When only checking for any legal move, steps are skipped once one is found. 
+ * 
+ * @param anyMove Stop as soon as one legal move is found 
+ * @param call Move info generation for one piece type 
+ */
+#define GEN_INFO_STEP(anyMove, call) if (!(anyMove) || info->NumMoves == 0) { call; } 
+
 /**
  * Adds all legal moves for one color to move info. 
  * 
  * @param col Color to move 
  * @param letter Color's letter (W or B)
+ * @param anyMove Stop as soon as one legal move is found 
  */
-#define FN_GEN_MOVE_INFO(col, letter) \
+#define FN_GEN_MOVE_INFO(col, letter, anyMove) \
 {\
     InitMoveInfo(info); \
     Color opp = OppositeColor(col); \
@@ -388,12 +398,12 @@ static inline void GenBQInfo(const Game* g, TARGET_SQUARE_PARAMS, MoveInfo* info
     });\
     if (chk == 0) \
     {\
-        Gen##letter##PInfo(g, AllBits, dirs, pinIndex, info); \
-        Gen##letter##NInfo(g, AllBits, dirs, pinIndex, info); \
-        Gen##letter##BInfo(g, AllBits, dirs, pinIndex, info); \
-        Gen##letter##RInfo(g, AllBits, dirs, pinIndex, info); \
-        Gen##letter##QInfo(g, AllBits, dirs, pinIndex, info); \
-        Gen##letter##KInfo(g, info); \
+        GEN_INFO_STEP(anyMove, Gen##letter##PInfo(g, AllBits, dirs, pinIndex, info)); \
+        GEN_INFO_STEP(anyMove, Gen##letter##NInfo(g, AllBits, dirs, pinIndex, info)); \
+        GEN_INFO_STEP(anyMove, Gen##letter##BInfo(g, AllBits, dirs, pinIndex, info)); \
+        GEN_INFO_STEP(anyMove, Gen##letter##RInfo(g, AllBits, dirs, pinIndex, info)); \
+        GEN_INFO_STEP(anyMove, Gen##letter##QInfo(g, AllBits, dirs, pinIndex, info)); \
+        GEN_INFO_STEP(anyMove, Gen##letter##KInfo(g, info)); \
     }\
     else \
     {\
@@ -402,16 +412,16 @@ static inline void GenBQInfo(const Game* g, TARGET_SQUARE_PARAMS, MoveInfo* info
         {\
             Square attacker = LeastSigBit(chk); \
             Bitboard okSquares = SlideTo[ksq][attacker] | Bits[attacker]; \
-            Gen##letter##PInfo(g, okSquares, dirs, pinIndex, info); \
-            Gen##letter##NInfo(g, okSquares, dirs, pinIndex, info); \
-            Gen##letter##BInfo(g, okSquares, dirs, pinIndex, info); \
-            Gen##letter##RInfo(g, okSquares, dirs, pinIndex, info); \
-            Gen##letter##QInfo(g, okSquares, dirs, pinIndex, info); \
-            Gen##letter##KInfo(g, info); \
+            GEN_INFO_STEP(anyMove, Gen##letter##PInfo(g, okSquares, dirs, pinIndex, info)); \
+            GEN_INFO_STEP(anyMove, Gen##letter##NInfo(g, okSquares, dirs, pinIndex, info)); \
+            GEN_INFO_STEP(anyMove, Gen##letter##BInfo(g, okSquares, dirs, pinIndex, info)); \
+            GEN_INFO_STEP(anyMove, Gen##letter##RInfo(g, okSquares, dirs, pinIndex, info)); \
+            GEN_INFO_STEP(anyMove, Gen##letter##QInfo(g, okSquares, dirs, pinIndex, info)); \
+            GEN_INFO_STEP(anyMove, Gen##letter##KInfo(g, info)); \
         }\
         else \
         {\
-            Gen##letter##KInfo(g, info); \
+            GEN_INFO_STEP(anyMove, Gen##letter##KInfo(g, info)); \
         }\
     }\
 }
@@ -426,14 +436,31 @@ void GenMoveInfo(const Game* g, MoveInfo* info)
 {
     if (g->Turn == ColorW) 
     {
-        FN_GEN_MOVE_INFO(ColorW, W); 
+        FN_GEN_MOVE_INFO(ColorW, W, false); 
     }
     else 
     {
-        FN_GEN_MOVE_INFO(ColorB, B); 
+        FN_GEN_MOVE_INFO(ColorB, B, false); 
     }
 }
 
+bool HasLegalMoves(const Game* g) 
+{
+    MoveInfo moveInfo; 
+    MoveInfo* info = &moveInfo; 
+
+    if (g->Turn == ColorW) 
+    {
+        FN_GEN_MOVE_INFO(ColorW, W, true); 
+    }
+    else 
+    {
+        FN_GEN_MOVE_INFO(ColorB, B, true); 
+    }
+
+    return info->NumMoves != 0; 
+}
+
 /**
  * Finds rook-style discovery attackers. 
  * 
@@ -506,12 +533,52 @@ static inline Bitboard DiscAttackers(const Game* g, Square sq, Color chkCol, Bit
 }
 
 /**
- * Finds discovered attacks on the enemy king. 
- * This is all that's needed for standard moves. 
+ * Finds pieces of the side to move that block one of its own sliders from 
+ * the enemy king. Moving such a piece off the line gives discovered check. 
  * 
- * @param col Color to move 
+ * @param g The game 
+ * @param oppKSquare Square of the enemy king 
+ * @param chkR Rook attacks from the enemy king 
+ * @param chkB Bishop attacks from the enemy king 
+ * @return Bitboard of blockers 
+ */
+static inline Bitboard DiscBlockers(const Game* g, Square oppKSquare, Bitboard chkR, Bitboard chkB) 
+{
+    Color col = g->Turn; 
+    Bitboard colOcc = g->Colors[col]; 
+    Bitboard colRQ = g->Pieces[MakePiece(PieceR, col)] | g->Pieces[MakePiece(PieceQ, col)]; 
+    Bitboard colBQ = g->Pieces[MakePiece(PieceB, col)] | g->Pieces[MakePiece(PieceQ, col)]; 
+    Bitboard blockR = chkR & colOcc; 
+    Bitboard blockB = chkB & colOcc; 
+
+    Bitboard disc = 0; 
+    FOR_EACH_BIT(RAttacks(oppKSquare, g->All & ~blockR) & colRQ, 
+    {
+        disc |= SlideTo[oppKSquare][sq] & blockR; 
+    });
+    FOR_EACH_BIT(BAttacks(oppKSquare, g->All & ~blockB) & colBQ, 
+    {
+        disc |= SlideTo[oppKSquare][sq] & blockB; 
+    });
+    return disc; 
+}
+
+/**
+ * Checks for a discovered check with the blockers from `DiscBlockers`. 
+ * A blocker that moves along its line away from or towards the king 
+ * still blocks it. 
+ */
+#define DISC_CHECK ((Bits[from] & disc) != 0 && pinIndex[sq] != pinIndex[from]) 
+
+/**
+ * Checks for a direct check with squares that attack the enemy king. 
+ * The squares are found once per position instead of once per move. 
+ * This is exact for normal moves: a piece cannot be on a line to the 
+ * king behind its own target square, or it would already give check. 
+ * 
+ * @param type Type of the moved piece 
  */
-#define DISC_ATTACKERS(col) (DiscAttackers(g, oppKSquare, OppositeColor(col), InverseBits[from], Bits[sq], pinIndex[from]))
+#define CHECK_SQUARE(type) ((Bits[sq] & checks[type]) != 0) 
 
 /**
  * Finds direct attacks on the enemy king from a knight. 
@@ -545,7 +612,7 @@ static inline Bitboard DiscAttackers(const Game* g, Square sq, Color chkCol, Bit
 {\
     FOR_EACH_BIT(to & ~proRank, \
     {\
-        moves->Moves[moves->Size++] = MakeEnPassantMove( \
+        moves->Moves[moves->Size++].Mv = MakeEnPassantMove( \
             from, \
             sq, \
             /* piece to move */ \
@@ -561,28 +628,28 @@ static inline Bitboard DiscAttackers(const Game* g, Square sq, Color chkCol, Bit
                 DiscAttackers(g, oppKSquare, OppositeColor(col), ~(Bits[from] | Bits[sq - 8 * ColorSign(col)]), Bits[sq], pinIndex[from]) | \
                 DiscAttackers(g, oppKSquare, OppositeColor(col), ~(Bits[from] | Bits[sq - 8 * ColorSign(col)]), Bits[sq], pinIndex[sq - 8 * ColorSign(col)]) \
             ) : (\
-                (AttacksP[col][sq] & oppK) | DISC_ATTACKERS(col) \
+                CHECK_SQUARE(PieceP) || DISC_CHECK \
         )); \
     });\
     FOR_EACH_BIT(to & proRank, \
     {\
         Piece at = PieceAt(&g->Board, sq); \
         /* discoveries */ \
-        Bitboard disc = DiscAttackers(g, oppKSquare, OppositeColor(col), InverseBits[from], Bits[sq], pinIndex[from]);\
-        /* all promotion moves */ \
-        moves->Moves[moves->Size++] = MakePromotionMove(from, sq, Piece##colLetter##P, Piece##colLetter##Q, at, (CHECK_Q) | disc); \
-        moves->Moves[moves->Size++] = MakePromotionMove(from, sq, Piece##colLetter##P, Piece##colLetter##R, at, (CHECK_R) | disc); \
-        moves->Moves[moves->Size++] = MakePromotionMove(from, sq, Piece##colLetter##P, Piece##colLetter##B, at, (CHECK_B) | disc); \
-        moves->Moves[moves->Size++] = MakePromotionMove(from, sq, Piece##colLetter##P, Piece##colLetter##N, at, (CHECK_N) | disc); \
+        bool discChk = DISC_CHECK; \
+        /* all promotion moves, the pawn may have blocked the new piece */ \
+        moves->Moves[moves->Size++].Mv = MakePromotionMove(from, sq, Piece##colLetter##P, Piece##colLetter##Q, at, (CHECK_Q) || discChk); \
+        moves->Moves[moves->Size++].Mv = MakePromotionMove(from, sq, Piece##colLetter##P, Piece##colLetter##R, at, (CHECK_R) || discChk); \
+        moves->Moves[moves->Size++].Mv = MakePromotionMove(from, sq, Piece##colLetter##P, Piece##colLetter##B, at, (CHECK_B) || discChk); \
+        moves->Moves[moves->Size++].Mv = MakePromotionMove(from, sq, Piece##colLetter##P, Piece##colLetter##N, at, (CHECK_N) || discChk); \
     });\
 }
 
-static inline void GenWPMoves(const Game* g, Square from, Bitboard to, Square oppKSquare, Bitboard oppK, const U8* pinIndex, MoveList* moves) 
+static inline void GenWPMoves(const Game* g, Square from, Bitboard to, Square oppKSquare, Bitboard oppK, const U8* pinIndex, const Bitboard* checks, Bitboard disc, MoveList* moves) 
 {
     FN_GEN_P_MOVES(ColorW, Rank8, W, B); 
 }
 
-static inline void GenBPMoves(const Game* g, Square from, Bitboard to, Square oppKSquare, Bitboard oppK, const U8* pinIndex, MoveList* moves) 
+static inline void GenBPMoves(const Game* g, Square from, Bitboard to, Square oppKSquare, Bitboard oppK, const U8* pinIndex, const Bitboard* checks, Bitboard disc, MoveList* moves) 
 {
     FN_GEN_P_MOVES(ColorB, Rank1, B, W); 
 }
@@ -600,24 +667,24 @@ static inline void GenBPMoves(const Game* g, Square from, Bitboard to, Square op
     to &= ~castle; \
     FOR_EACH_BIT(to, \
     {\
-        moves->Moves[moves->Size++] = MakeMove(from, sq, Piece##letter##K, PieceAt(&g->Board, sq), DiscAttackers(g, oppKSquare, OppositeColor(g->Turn), InverseBits[from], Bits[sq], pinIndex[from])); \
+        moves->Moves[moves->Size++].Mv = MakeMove(from, sq, Piece##letter##K, PieceAt(&g->Board, sq), DISC_CHECK); \
     });\
     FOR_EACH_BIT(castle, \
     {\
         switch (sq) \
         {\
-            case G##rank: moves->Moves[moves->Size++] = MakeCastleMove(E##rank, G##rank, Piece##letter##K, MoveCastle##letter##K, RAttacks(F##rank, g->All & ~(1ULL << E##rank)) & oppK); break; \
-            case C##rank: moves->Moves[moves->Size++] = MakeCastleMove(E##rank, C##rank, Piece##letter##K, MoveCastle##letter##Q, RAttacks(D##rank, g->All & ~(1ULL << E##rank)) & oppK); break; \
+            case G##rank: moves->Moves[moves->Size++].Mv = MakeCastleMove(E##rank, G##rank, Piece##letter##K, MoveCastle##letter##K, RAttacks(F##rank, g->All & ~(1ULL << E##rank)) & oppK); break; \
+            case C##rank: moves->Moves[moves->Size++].Mv = MakeCastleMove(E##rank, C##rank, Piece##letter##K, MoveCastle##letter##Q, RAttacks(D##rank, g->All & ~(1ULL << E##rank)) & oppK); break; \
             default: break; \
         }\
     });\
 
-static inline void GenWKMoves(const Game* g, Square from, Bitboard to, Square oppKSquare, Bitboard oppK, const U8* pinIndex, MoveList* moves) 
+static inline void GenWKMoves(const Game* g, Square from, Bitboard to, Bitboard oppK, const U8* pinIndex, Bitboard disc, MoveList* moves) 
 {
     FN_GEN_K_MOVES(ColorW, W, 1); 
 }
 
-static inline void GenBKMoves(const Game* g, Square from, Bitboard to, Square oppKSquare, Bitboard oppK, const U8* pinIndex, MoveList* moves) 
+static inline void GenBKMoves(const Game* g, Square from, Bitboard to, Bitboard oppK, const U8* pinIndex, Bitboard disc, MoveList* moves) 
 {
     FN_GEN_K_MOVES(ColorB, B, 8); 
 }
@@ -625,13 +692,12 @@ static inline void GenBKMoves(const Game* g, Square from, Bitboard to, Square op
 /**
  * Generate normal piece moves. 
  * 
- * @param col Color to play 
- * @param atk Direct attacks on the enemy king from the moved piece 
+ * @param type Type of the moved piece 
  */
-#define GEN_MOVES(col, atk) \
+#define GEN_MOVES(type) \
     FOR_EACH_BIT(to, \
     {\
-        moves->Moves[moves->Size++] = MakeMove(from, sq, pc, PieceAt(&g->Board, sq), (atk) | DISC_ATTACKERS(col)); \
+        moves->Moves[moves->Size++].Mv = MakeMove(from, sq, pc, PieceAt(&g->Board, sq), CHECK_SQUARE(type) || DISC_CHECK); \
     });
 
 /**
@@ -646,26 +712,43 @@ static inline void GenBKMoves(const Game* g, Square from, Bitboard to, Square op
     Square oppKSquare = LeastSigBit(oppK); \
     /* pin type array for detecting discovery checks */ \
     const U8* pinIndex = PinIndex[oppKSquare]; \
+    /* squares that give direct or discovered check */ \
+    Bitboard chkR = RAttacks(oppKSquare, g->All); \
+    Bitboard chkB = BAttacks(oppKSquare, g->All); \
+    const Bitboard checks[NumPieceTypes] = \
+    {\
+        AttacksP[OppositeColor(col)][oppKSquare], MovesN[oppKSquare], chkB, chkR, chkB | chkR, 0 \
+    };\
+    Bitboard disc = DiscBlockers(g, oppKSquare, chkR, chkB); \
     for (int pcId = 0; pcId < info->NumPieces; pcId++) \
     {\
-        Bitboard to = info->Moves[pcId]; \
         Piece pc = info->Pieces[pcId]; \
         PieceType type = TypeOfPiece(pc); \
         Square from = info->From[pcId]; \
+        Bitboard to = info->Moves[pcId] & (masks[type] | (((Bits[from] & fromAny) != 0) * AllBits)); \
         switch (type) \
         {\
-            case PieceP: Gen##letter##PMoves(g, from, info->Moves[pcId], oppKSquare, oppK, pinIndex, moves); break; \
-            case PieceK: Gen##letter##KMoves(g, from, info->Moves[pcId], oppKSquare, oppK, pinIndex, moves); break; \
-            case PieceN: GEN_MOVES(col, CHECK_N); break; \
-            case PieceB: GEN_MOVES(col, CHECK_B); break; \
-            case PieceR: GEN_MOVES(col, CHECK_R); break; \
-            case PieceQ: GEN_MOVES(col, CHECK_Q); break; \
+            case PieceP: Gen##letter##PMoves(g, from, to, oppKSquare, oppK, pinIndex, checks, disc, moves); break; \
+            case PieceK: Gen##letter##KMoves(g, from, to, oppK, pinIndex, disc, moves); break; \
+            case PieceN: GEN_MOVES(PieceN); break; \
+            case PieceB: GEN_MOVES(PieceB); break; \
+            case PieceR: GEN_MOVES(PieceR); break; \
+            case PieceQ: GEN_MOVES(PieceQ); break; \
             default: break; \
         }\
     }\
 } 
 
-void GenMovesFromInfo(const Game* g, const MoveInfo* info, MoveList* moves) 
+/**
+ * Adds moves from a move info into a list, keeping only moves to some squares. 
+ * 
+ * @param g The game 
+ * @param info Move info 
+ * @param masks Allowed target squares for each piece type 
+ * @param fromAny Pieces on these squares keep all of their moves 
+ * @param moves List output 
+ */
+static inline void GenMovesFromInfoTypeMask(const Game* g, const MoveInfo* info, const Bitboard* masks, Bitboard fromAny, MoveList* moves) 
 {
     if (g->Turn == ColorW) 
     {
@@ -675,4 +758,90 @@ void GenMovesFromInfo(const Game* g, const MoveInfo* info, MoveList* moves)
     {
         FN_GEN_MOVES(ColorB, B); 
     }
-}
\ No newline at end of file
+}
+
+void GenMovesFromInfoMask(const Game* g, const MoveInfo* info, Bitboard mask, Bitboard pawnMask, MoveList* moves) 
+{
+    const Bitboard masks[NumPieceTypes] = { pawnMask, mask, mask, mask, mask, mask }; 
+    GenMovesFromInfoTypeMask(g, info, masks, 0, moves); 
+}
+
+void GenTacticalMoves(const Game* g, MoveList* moves) 
+{
+    MoveInfo info; 
+    GenMoveInfo(g, &info); 
+
+    Color col = g->Turn; 
+    Color opp = OppositeColor(col); 
+    Bitboard oppOcc = g->Colors[opp]; 
+    Square oppKSquare = LeastSigBit(g->Pieces[MakePiece(PieceK, opp)]); 
+
+    // squares that give direct check 
+    Bitboard chkR = RAttacks(oppKSquare, g->All); 
+    Bitboard chkB = BAttacks(oppKSquare, g->All); 
+
+    // pieces that can give discovered check by moving off the line 
+    Bitboard disc = DiscBlockers(g, oppKSquare, chkR, chkB); 
+
+    // castling can check with the rook 
+    Bitboard castle = (col == ColorW) ? Bits[C1] | Bits[G1] : Bits[C8] | Bits[G8]; 
+
+    const Bitboard masks[NumPieceTypes] = 
+    {
+        oppOcc | Rank1 | Rank8 | Bits[g->EnPassant] | AttacksP[opp][oppKSquare], 
+        oppOcc | MovesN[oppKSquare], 
+        oppOcc | chkB, 
+        oppOcc | chkR, 
+        oppOcc | chkB | chkR, 
+        oppOcc | castle 
+    };
+
+    U64 start = moves->Size; 
+    GenMovesFromInfoTypeMask(g, &info, masks, disc, moves); 
+
+    // masks are a superset: drop quiet moves that turned out not to check 
+    U64 end = start; 
+    for (U64 i = start; i < moves->Size; i++) 
+    {
+        if (IsTactical(moves->Moves[i].Mv)) 
+        {
+            moves->Moves[end++] = moves->Moves[i]; 
+        }
+    }
+    PopMovesToSize(moves, end); 
+}
+
+Move FindLegalMove(const Game* g, const MoveInfo* info, Move mv, MoveList* moves) 
+{
+    Square from = FromSquare(mv); 
+    Square to = ToSquare(mv); 
+    Piece pc = FromPiece(mv); 
+
+    for (int pcId = 0; pcId < info->NumPieces; pcId++) 
+    {
+        if (info->From[pcId] != from || info->Pieces[pcId] != pc) continue; 
+        if ((info->Moves[pcId] & Bits[to]) == 0) return NoMove; 
+
+        // only list moves to the target square: flags (capture, promotion, check, ...) must match this position 
+        MoveInfo single; 
+        single.NumPieces = 1; 
+        single.NumMoves = 0; 
+        single.From[0] = from; 
+        single.Pieces[0] = pc; 
+        single.Moves[0] = Bits[to]; 
+
+        U64 start = moves->Size; 
+        GenMovesFromInfo(g, &single, moves); 
+
+        Move found = NoMove; 
+        for (U64 i = start; i < moves->Size; i++) 
+        {
+            if (IsSameMove(moves->Moves[i].Mv, mv)) found = moves->Moves[i].Mv; 
+        }
+
+        PopMovesToSize(moves, start); 
+        return found; 
+    }
+
+    return NoMove; 
+}
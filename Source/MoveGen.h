@@ -15,7 +15,12 @@
 #include "Move.h"
 
 /**
- * Used to store moves. 
+ * Move with its move order value. 
+ */
+typedef struct ScoredMove ScoredMove; 
+
+/**
+ * Used to store the moves of a single position. 
  */
 typedef struct MoveList MoveList; 
 
@@ -24,14 +29,21 @@ typedef struct MoveList MoveList;
  */
 typedef struct MoveInfo MoveInfo; 
 
+struct ScoredMove 
+{
+    Move Mv; 
+    int Value; 
+};
+
 /**
- * Maximum possible moves a color has in a legal position. 
+ * Moves and their values are stored together, so sorting moves only 
+ * touches one array. Search keeps one list per ply instead of sharing a 
+ * list for the whole line, so a list never holds more moves than a 
+ * position can have. 
  */
-#define MaxMovesPerTurn 218
-
 struct MoveList 
 {
-    Move Moves[MaxMovesPerTurn * MaxDepth]; 
+    ScoredMove Moves[MaxMovesPerTurn]; 
     U64 Size; 
 };
 
@@ -44,7 +56,7 @@ struct MoveList
  */
 static inline void SwapMoves(MoveList* m, U64 a, U64 b) 
 {
-    Move tmp = m->Moves[a]; 
+    ScoredMove tmp = m->Moves[a]; 
     m->Moves[a] = m->Moves[b]; 
     m->Moves[b] = tmp; 
 }
@@ -101,6 +113,26 @@ struct MoveInfo
  */
 void GenMoveInfo(const Game* g, MoveInfo* info); 
 
+/**
+ * Checks if the side to move has any legal move. Stops generating as soon 
+ * as one move is found. 
+ * 
+ * @param g Game state 
+ * @return True if there is a legal move 
+ */
+bool HasLegalMoves(const Game* g); 
+
+/**
+ * Put move info moves into a list, keeping only moves to some squares. 
+ * 
+ * @param g Game state 
+ * @param info Move info 
+ * @param mask Allowed target squares for pieces other than pawns 
+ * @param pawnMask Allowed target squares for pawns 
+ * @param moves List output 
+ */
+void GenMovesFromInfoMask(const Game* g, const MoveInfo* info, Bitboard mask, Bitboard pawnMask, MoveList* moves); 
+
 /**
  * Put move info moves into a list 
  * 
@@ -108,7 +140,49 @@ void GenMoveInfo(const Game* g, MoveInfo* info);
  * @param info Move info 
  * @param moves List output
  */
-void GenMovesFromInfo(const Game* g, const MoveInfo* info, MoveList* moves); 
+static inline void GenMovesFromInfo(const Game* g, const MoveInfo* info, MoveList* moves) 
+{
+    GenMovesFromInfoMask(g, info, AllBits, AllBits, moves); 
+}
+
+/**
+ * Checks if a move (for example from the transposition table) can be played. 
+ * The check flag of the move is ignored. 
+ * 
+ * @param g Game state 
+ * @param info Move info for the game state 
+ * @param mv The move 
+ * @param moves Scratch list: moves are added past the end and removed again 
+ * @return The legal move with flags for this position, or NoMove 
+ */
+Move FindLegalMove(const Game* g, const MoveInfo* info, Move mv, MoveList* moves); 
+
+/**
+ * Gets target squares of tactical moves: captures, en passant and promotions. 
+ * Quiet target squares are the complement of these. 
+ * 
+ * @param g Game state 
+ * @param mask Output for pieces other than pawns 
+ * @param pawnMask Output for pawns 
+ */
+static inline void GetTacticalMasks(const Game* g, Bitboard* mask, Bitboard* pawnMask) 
+{
+    Bitboard opp = g->Colors[OppositeColor(g->Turn)]; 
+    Bitboard proRank = g->Turn == ColorW ? Rank8 : Rank1; 
+
+    *mask = opp; 
+    *pawnMask = opp | proRank | Bits[g->EnPassant]; 
+}
+
+/**
+ * Generate only tactical moves (captures, checks and promotions) and store 
+ * them in a list. Quiet moves are filtered out by target square before 
+ * their check flags are computed. 
+ * 
+ * @param g Game state 
+ * @param moves List output 
+ */
+void GenTacticalMoves(const Game* g, MoveList* moves); 
 
 /**
  * Generate moves and store them in a list. 
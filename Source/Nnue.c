@@ -0,0 +1,306 @@
+/**
+ * @file Nnue.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Implements the efficiently updatable neural network (NNUE) evaluation. 
+ */
+
+#include "Nnue.h" 
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+
+#if defined(AVX2) || defined(AVX512)
+    #include <immintrin.h> 
+#endif
+
+#include "Game.h" 
+
+/**
+ * Network weights. 
+ */
+typedef struct Network Network; 
+
+struct Network 
+{
+    S16 FeatureWeights[NnueInputs][NnueHidden]; 
+    S16 FeatureBias[NnueHidden]; 
+    S8 OutputWeights[2 * NnueHidden]; 
+    S32 OutputBias; 
+};
+
+bool UseNnue = false; 
+
+static Network Net; 
+
+static bool IsNetLoaded = false; 
+
+bool LoadNetwork(const char* path) 
+{
+    FILE* f = fopen(path, "rb"); 
+    if (!f) return false; 
+
+    // the file is read into a copy so a bad file keeps the old weights 
+    Network* net = malloc(sizeof(Network)); 
+    char magic[4]; 
+
+    bool ok = fread(magic, 1, sizeof(magic), f) == sizeof(magic) 
+           && memcmp(magic, NnueMagic, sizeof(magic)) == 0 
+           && fread(net->FeatureWeights, sizeof(net->FeatureWeights), 1, f) == 1 
+           && fread(net->FeatureBias, sizeof(net->FeatureBias), 1, f) == 1 
+           && fread(net->OutputWeights, sizeof(net->OutputWeights), 1, f) == 1 
+           && fread(&net->OutputBias, sizeof(net->OutputBias), 1, f) == 1 
+           && fgetc(f) == EOF; 
+
+    if (ok) 
+    {
+        Net = *net; 
+        IsNetLoaded = true; 
+    }
+
+    free(net); 
+    fclose(f); 
+    return ok; 
+}
+
+bool IsNetworkLoaded(void) 
+{
+    return IsNetLoaded; 
+}
+
+/**
+ * Gets the input index of a piece as seen by one side. The board is 
+ * flipped for black, so both sides see their own pieces from the bottom. 
+ * 
+ * @param view Side that sees the piece 
+ * @param pc The piece 
+ * @param sq Square of the piece 
+ * @return Input index 
+ */
+static inline int FeatureIndex(Color view, Piece pc, Square sq) 
+{
+    if (view == ColorB) sq = FlipRank(sq); 
+
+    return (ColorOfPiece(pc) != view) * (NnueInputs / 2) + TypeOfPiece(pc) * NumSquares + sq; 
+}
+
+/**
+ * Adds the weights of a piece to the accumulators of both sides. 
+ * 
+ * @param acc The accumulator 
+ * @param pc The piece 
+ * @param sq Square of the piece 
+ */
+static inline void AddFeature(Accumulator* acc, Piece pc, Square sq) 
+{
+    for (Color view = ColorW; view <= ColorB; view++) 
+    {
+        const S16* w = Net.FeatureWeights[FeatureIndex(view, pc, sq)]; 
+        S16* v = acc->Values[view]; 
+
+        for (int i = 0; i < NnueHidden; i++) v[i] += w[i]; 
+    }
+}
+
+/**
+ * Subtracts the weights of a piece from the accumulators of both sides. 
+ * 
+ * @param acc The accumulator 
+ * @param pc The piece 
+ * @param sq Square of the piece 
+ */
+static inline void SubFeature(Accumulator* acc, Piece pc, Square sq) 
+{
+    for (Color view = ColorW; view <= ColorB; view++) 
+    {
+        const S16* w = Net.FeatureWeights[FeatureIndex(view, pc, sq)]; 
+        S16* v = acc->Values[view]; 
+
+        for (int i = 0; i < NnueHidden; i++) v[i] -= w[i]; 
+    }
+}
+
+void ComputeAccumulator(const Game* g, Accumulator* acc) 
+{
+    memcpy(acc->Values[ColorW], Net.FeatureBias, sizeof(Net.FeatureBias)); 
+    memcpy(acc->Values[ColorB], Net.FeatureBias, sizeof(Net.FeatureBias)); 
+
+    for (Piece pc = 0; pc < NumPieces; pc++) 
+    {
+        FOR_EACH_BIT(g->Pieces[pc], 
+        {
+            AddFeature(acc, pc, sq); 
+        });
+    }
+}
+
+void RefreshAccumulator(Game* g) 
+{
+    // only games that are evaluated with the network need accumulators 
+    if (!g->Acc) g->Acc = malloc(sizeof(Accumulator) * (MaxHistory + 1)); 
+
+    ComputeAccumulator(g, &g->Acc[g->Depth]); 
+}
+
+void ReleaseAccumulator(Game* g) 
+{
+    free(g->Acc); 
+    g->Acc = NULL; 
+}
+
+void PushAccumulator(Game* g, Move mv) 
+{
+    Accumulator* acc = &g->Acc[g->Depth + 1]; 
+    *acc = g->Acc[g->Depth]; 
+
+    Piece pc = FromPiece(mv); 
+    Piece pro = PromotionPiece(mv); 
+    Piece tgt = TargetPiece(mv); 
+
+    Square src = FromSquare(mv); 
+    Square dst = ToSquare(mv); 
+
+    int casIndex = CastleIndex(mv); 
+
+    if (IsEnPassant(mv)) 
+    {
+        Square rm = dst - 8 * ColorSign(g->Turn); 
+
+        SubFeature(acc, pc, src); 
+        AddFeature(acc, pc, dst); 
+        SubFeature(acc, tgt, rm); 
+    }
+    else if (casIndex) 
+    {
+        Piece rook = MakePiece(PieceR, g->Turn); 
+
+        SubFeature(acc, pc, MoveCastleSquareK[casIndex][0]); 
+        AddFeature(acc, pc, MoveCastleSquareK[casIndex][1]); 
+        SubFeature(acc, rook, MoveCastleSquareR[casIndex][0]); 
+        AddFeature(acc, rook, MoveCastleSquareR[casIndex][1]); 
+    }
+    else 
+    {
+        // the promotion piece is the moving piece if there is no promotion 
+        SubFeature(acc, pc, src); 
+        AddFeature(acc, pro, dst); 
+        if (tgt != NoPiece) SubFeature(acc, tgt, dst); 
+    }
+}
+
+#if defined(AVX512)
+
+/**
+ * Clips one side's accumulator and multiplies it with output weights. 
+ * 
+ * @param acc Accumulator values of one side 
+ * @param weights Output weights for that side 
+ * @return Weighted sum 
+ */
+static inline S32 ForwardSide(const S16* acc, const S8* weights) 
+{
+    const __m512i zero = _mm512_setzero_si512(); 
+    const __m512i max = _mm512_set1_epi16(NnueQA); 
+    const __m512i ones = _mm512_set1_epi16(1); 
+
+    // packing interleaves the two inputs in 64-bit blocks per 128-bit lane 
+    const __m512i order = _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0); 
+
+    __m512i sum = zero; 
+    for (int i = 0; i < NnueHidden; i += 64) 
+    {
+        __m512i a = _mm512_loadu_si512((const void*) (acc + i)); 
+        __m512i b = _mm512_loadu_si512((const void*) (acc + i + 32)); 
+        a = _mm512_min_epi16(_mm512_max_epi16(a, zero), max); 
+        b = _mm512_min_epi16(_mm512_max_epi16(b, zero), max); 
+
+        __m512i act = _mm512_permutexvar_epi64(order, _mm512_packus_epi16(a, b)); 
+        __m512i w = _mm512_loadu_si512((const void*) (weights + i)); 
+
+        // activations are at most 127, so a pair of products cannot saturate 
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(_mm512_maddubs_epi16(act, w), ones)); 
+    }
+
+    return _mm512_reduce_add_epi32(sum); 
+}
+
+#elif defined(AVX2)
+
+/**
+ * Clips one side's accumulator and multiplies it with output weights. 
+ * 
+ * @param acc Accumulator values of one side 
+ * @param weights Output weights for that side 
+ * @return Weighted sum 
+ */
+static inline S32 ForwardSide(const S16* acc, const S8* weights) 
+{
+    const __m256i zero = _mm256_setzero_si256(); 
+    const __m256i max = _mm256_set1_epi16(NnueQA); 
+    const __m256i ones = _mm256_set1_epi16(1); 
+
+    __m256i sum = zero; 
+    for (int i = 0; i < NnueHidden; i += 32) 
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i*) (acc + i)); 
+        __m256i b = _mm256_loadu_si256((const __m256i*) (acc + i + 16)); 
+        a = _mm256_min_epi16(_mm256_max_epi16(a, zero), max); 
+        b = _mm256_min_epi16(_mm256_max_epi16(b, zero), max); 
+
+        // packing interleaves the two inputs in 64-bit blocks per 128-bit lane 
+        __m256i act = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8); 
+        __m256i w = _mm256_loadu_si256((const __m256i*) (weights + i)); 
+
+        // activations are at most 127, so a pair of products cannot saturate 
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(act, w), ones)); 
+    }
+
+    __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)); 
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E)); 
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1)); 
+    return _mm_cvtsi128_si32(half); 
+}
+
+#else
+
+/**
+ * Clips one side's accumulator and multiplies it with output weights. 
+ * 
+ * @param acc Accumulator values of one side 
+ * @param weights Output weights for that side 
+ * @return Weighted sum 
+ */
+static inline S32 ForwardSide(const S16* acc, const S8* weights) 
+{
+    S32 sum = 0; 
+
+    for (int i = 0; i < NnueHidden; i++) 
+    {
+        int v = acc[i]; 
+        if (v < 0) v = 0; 
+        if (v > NnueQA) v = NnueQA; 
+        sum += v * weights[i]; 
+    }
+
+    return sum; 
+}
+
+#endif
+
+int EvaluateNnue(const Game* g) 
+{
+    const Accumulator* acc = &g->Acc[g->Depth]; 
+    Color col = g->Turn; 
+    Color opp = OppositeColor(col); 
+
+    S32 out = Net.OutputBias 
+            + ForwardSide(acc->Values[col], Net.OutputWeights) 
+            + ForwardSide(acc->Values[opp], Net.OutputWeights + NnueHidden); 
+
+    int eval = (int) ((S64) out * NnueScale / (NnueQA * NnueQB)); 
+    return ColorSign(col) * eval; 
+}
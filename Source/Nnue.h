@@ -0,0 +1,87 @@
+/**
+ * @file Nnue.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Defines the efficiently updatable neural network (NNUE) evaluation. 
+ * 
+ * The network has one input per piece type, color and square, seen from 
+ * each side. Each side has an accumulator holding the first layer output, 
+ * which is updated as pieces move instead of being computed again. The 
+ * accumulators of the side to move and the other side are clipped to 
+ * [0, NnueQA] and combined into the evaluation by the output layer. 
+ * 
+ * Weights file layout (little endian): 
+ * - NnueMagic (4 bytes) 
+ * - feature weights: S16[NnueInputs][NnueHidden] 
+ * - feature biases: S16[NnueHidden] 
+ * - output weights: S8[2 * NnueHidden] (side to move first) 
+ * - output bias: S32 
+ */
+
+#pragma once 
+
+#include <stdbool.h> 
+
+#include "Piece.h" 
+#include "Types.h" 
+
+/**
+ * Number of network inputs (colors * piece types * squares). 
+ */
+#define NnueInputs 768 
+
+/**
+ * Number of first layer outputs for each side (multiple of 64). 
+ */
+#define NnueHidden 256 
+
+/**
+ * Quantization scale of first layer values, also the clipping maximum. 
+ */
+#define NnueQA 127 
+
+/**
+ * Quantization scale of output weights. 
+ */
+#define NnueQB 64 
+
+/**
+ * Network output of 1.0 in centipawns. 
+ */
+#define NnueScale 400 
+
+/**
+ * First 4 bytes of a weights file. 
+ */
+#define NnueMagic "HNN1" 
+
+/**
+ * First layer outputs for both sides of a position. 
+ */
+typedef struct Accumulator Accumulator; 
+
+struct Accumulator 
+{
+    S16 Values[NumColors][NnueHidden]; 
+};
+
+/**
+ * Set to use the network instead of the classical evaluation. 
+ */
+extern bool UseNnue; 
+
+/**
+ * Loads network weights from a file. 
+ * 
+ * @param path Weights file 
+ * @return True if loaded, false if the file is missing or has the wrong size 
+ */
+bool LoadNetwork(const char* path); 
+
+/**
+ * @return True if network weights have been loaded 
+ */
+bool IsNetworkLoaded(void); 
@@ -0,0 +1,31 @@
+/**
+ * @file PawnTable.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Implements the pawn structure hash table. 
+ */
+
+#include "PawnTable.h" 
+
+#include <stdlib.h> 
+#include <string.h> 
+
+void CreatePawnTable(PawnTable* pt) 
+{
+    pt->Entries = calloc(PawnTableSize, sizeof(PawnEntry)); 
+    pt->Probes = 0; 
+    pt->Hits = 0; 
+}
+
+void DestroyPawnTable(PawnTable* pt) 
+{
+    free(pt->Entries); 
+}
+
+void ClearPawnTable(PawnTable* pt) 
+{
+    memset(pt->Entries, 0, PawnTableSize * sizeof(PawnEntry)); 
+}
@@ -0,0 +1,92 @@
+/**
+ * @file PawnTable.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Defines the pawn structure hash table. 
+ * 
+ * Pawn structure changes in few moves, so its evaluation terms are stored 
+ * by the pawn hash of the position and reused. Each search thread has its 
+ * own table, so entries are written without any synchronization. 
+ */
+
+#pragma once 
+
+#include <stdbool.h> 
+
+#include "Bitboard.h" 
+#include "Types.h" 
+#include "Zobrist.h" 
+
+/**
+ * Number of entries in a pawn table (must be a power of two). 
+ */
+#define PawnTableSize 16384 
+
+/**
+ * Pawn structure hash table. 
+ */
+typedef struct PawnTable PawnTable; 
+
+/**
+ * Evaluation data of a pawn structure. 
+ */
+typedef struct PawnEntry PawnEntry; 
+
+struct PawnEntry 
+{
+    Zobrist Key; 
+    Bitboard Attacks[NumColors]; // squares attacked by the pawns of each color 
+    int Eval; // pawn structure terms, white minus black 
+};
+
+struct PawnTable 
+{
+    PawnEntry* Entries; 
+    U64 Probes; 
+    U64 Hits; 
+};
+
+/**
+ * Initializes an empty pawn table. 
+ * 
+ * @param pt The table 
+ */
+void CreatePawnTable(PawnTable* pt); 
+
+/**
+ * Deinitializes a pawn table. 
+ * 
+ * @param pt The table 
+ */
+void DestroyPawnTable(PawnTable* pt); 
+
+/**
+ * Removes all entries from a pawn table. This must be called when the 
+ * pawn structure weights change. 
+ * 
+ * @param pt The table 
+ */
+void ClearPawnTable(PawnTable* pt); 
+
+/**
+ * Gets the entry for a pawn structure. If the key of the entry is 
+ * different, the caller must compute the entry and set its key. 
+ * Empty entries are valid for positions without pawns, which have a 
+ * pawn hash of 0. 
+ * 
+ * @param pt The table 
+ * @param key Pawn hash 
+ * @return The entry 
+ */
+static inline PawnEntry* ProbePawnTable(PawnTable* pt, Zobrist key) 
+{
+    PawnEntry* entry = &pt->Entries[key & (PawnTableSize - 1)]; 
+
+    pt->Probes++; 
+    pt->Hits += entry->Key == key; 
+
+    return entry; 
+}
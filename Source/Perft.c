@@ -6,11 +6,17 @@
  * Copyright (c) 2023 Nicholas Hamilton
  * 
  * Performance testing. Useful for making sure movegen is valid. 
+ * 
+ * Runs the built in positions or an EPD perft suite, and prints the 
+ * results as text, CSV or JSON. See PrintUsage for the options. 
  */
 
+#include <ctype.h> 
+#include <inttypes.h> 
 #include <math.h> 
 #include <stdio.h> 
-#include <time.h> 
+#include <stdlib.h> 
+#include <string.h> 
 
 #include "Bitboard.h" 
 #include "Castle.h"
@@ -19,19 +25,46 @@
 #include "Piece.h"
 #include "Random.h" 
 #include "Square.h"
+#include "TimeMan.h" 
 #include "Vector.h" 
 
-static int s_Total = 0; 
+#ifndef ENGINE_NAME 
+    #define ENGINE_NAME "Halcyon" 
+#endif 
+
+/**
+ * Deepest perft depth that can be stored for a position. 
+ */
+#define MaxPerftDepth 9 
+
+/**
+ * Longest EPD line that can be loaded. 
+ */
+#define MaxEpdLine 1024 
+
+#define MinPerftSpeedTime 0.1 
+
+typedef enum 
+{
+    FormatText, 
+    FormatCsv, 
+    FormatJson 
+} OutputFormat; 
 
 typedef struct PerftData PerftData; 
 
 struct PerftData
 {
     const char* Fen; 
-    const U64 Expected[10]; 
+    U64 Expected[MaxPerftDepth + 1]; // node count at each depth, ends at the first 0 
 };
 
-#define MinPerftSpeedTime 0.1
+static int s_Total = 0; 
+static int s_Threads = 1; 
+static int s_MaxDepth = MaxPerftDepth; 
+static OutputFormat s_Format = FormatText; 
+static PerftCache* s_Cache = NULL; 
+static bool s_FirstRow = true; 
 
 struct PerftSpeed 
 {
@@ -47,31 +80,87 @@ struct PerftSpeed
     .N = 0
 }; 
 
-bool RunPerft(const char* name, const char* fen, const U64* expected) 
+/**
+ * Prints the result of one depth of one position. 
+ * 
+ * @param index Position number 
+ * @param fen Position 
+ * @param depth Perft depth 
+ * @param expected Expected node count 
+ * @param result Perft result 
+ * @param timeMs Duration in milliseconds 
+ */
+static void PrintPerftRow(int index, const char* fen, int depth, U64 expected, const PerftResult* result, TimePoint timeMs) 
+{
+    double mnps = result->Total / (double) timeMs / 1000; 
+    double hits = 100.0 * result->CacheHits / (result->CacheProbes ? result->CacheProbes : 1); 
+    bool pass = result->Total == expected; 
+
+    switch (s_Format) 
+    {
+        case FormatText: 
+            printf("Depth: %d, Total: %" PRIu64 "", depth, result->Total); 
+            if (s_Cache) printf(", Hits: %.1lf%%", hits); 
+            printf(", Time: %" PRIu64 "ms, Speed: %.2lfMnps - %s\n", timeMs, mnps, pass ? "PASS" : "FAIL"); 
+            if (!pass) 
+            {
+                printf("FAILURE: Expected %" PRIu64 ", difference of %" PRId64 "\n", expected, (S64) expected - (S64) result->Total); 
+            }
+            break; 
+
+        case FormatCsv: 
+            printf("%d,%s,%d,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.3lf,%.1lf,%s\n", 
+                index, fen, depth, expected, result->Total, timeMs, mnps, s_Cache ? hits : 0.0, pass ? "pass" : "fail"); 
+            break; 
+
+        case FormatJson: 
+            printf("%s\n    {\"position\": %d, \"fen\": \"%s\", \"depth\": %d, \"expected\": %" PRIu64 ", \"nodes\": %" PRIu64 ", " 
+                   "\"time_ms\": %" PRIu64 ", \"mnps\": %.3lf, \"hit_rate\": %.1lf, \"pass\": %s}", 
+                s_FirstRow ? "" : ",", index, fen, depth, expected, result->Total, timeMs, mnps, s_Cache ? hits : 0.0, pass ? "true" : "false"); 
+            break; 
+    }
+
+    s_FirstRow = false; 
+    fflush(stdout); 
+}
+
+/**
+ * Runs perft on a position at every depth with a known node count. 
+ * 
+ * @param index Position number 
+ * @param num Number of positions 
+ * @param test Position and expected node counts 
+ * @return True if all node counts are correct 
+ */
+bool RunPerft(int index, int num, const PerftData* test) 
 {
     s_Total++; 
 
     bool ret = true; 
 
     Game* g = NewGame(); 
-    LoadFen(g, fen); 
+    LoadFen(g, test->Fen); 
 
-    printf("%s\n%s\n", name, fen); 
-    PrintGame(g); 
+    if (s_Format == FormatText) 
+    {
+        printf("Position %d / %d\n%s\n", index, num, test->Fen); 
+        PrintGame(g); 
+    }
 
-    int i = -1; 
-    while (expected[++i] > 0) 
+    for (int depth = 1; depth <= s_MaxDepth && test->Expected[depth] > 0; depth++) 
     {
-        U64 e = expected[i]; 
+        U64 e = test->Expected[depth]; 
 
-        clock_t c = clock(); 
-        U64 total = Perft(g, i);
-        clock_t c2 = clock(); 
+        PerftResult result; 
+        TimePoint c = GetTimeMs(); 
+        U64 total = ParallelPerft(g, depth, s_Threads, s_Cache, &result); 
+        TimePoint c2 = GetTimeMs(); 
 
-        double time = (double) (c2 - c) / CLOCKS_PER_SEC; 
-        double nps = total / time; 
-        printf(", Time: %.2lfms, Speed: %.2lfMnps - %s\n", time * 1000, nps / 1000000, e == total ? "PASS" : "FAIL"); 
+        TimePoint timeMs = c2 > c ? c2 - c : 1; 
+        PrintPerftRow(index, test->Fen, depth, e, &result, timeMs); 
 
+        double time = (double) timeMs / 1000; 
+        double nps = total / time; 
         if (time >= MinPerftSpeedTime) 
         {
             speed.N++; 
@@ -80,21 +169,98 @@ bool RunPerft(const char* name, const char* fen, const U64* expected)
             if (nps < speed.Slow) speed.Slow = nps; 
         }
 
-        if (e != total) 
+        if (e != total) ret = false; 
+    }
+
+    if (s_Format == FormatText) printf("DONE\n\n"); 
+
+    FreeGame(g); 
+    return ret; 
+}
+
+/**
+ * Loads a perft suite in EPD format, one position per line: 
+ * `<fen> ;D1 <count> ;D2 <count> ...` 
+ * 
+ * @param path File to load 
+ * @param num Output number of positions 
+ * @return Positions, or NULL if the file could not be read 
+ */
+static PerftData* LoadEpd(const char* path, int* num) 
+{
+    FILE* f = fopen(path, "r"); 
+    if (!f) 
+    {
+        fprintf(stderr, "Could not open %s\n", path); 
+        return NULL; 
+    }
+
+    int capacity = 64; 
+    PerftData* tests = malloc(sizeof(PerftData) * capacity); 
+    *num = 0; 
+
+    char line[MaxEpdLine]; 
+    while (fgets(line, MaxEpdLine, f)) 
+    {
+        // lines without counts (comments, blank lines) are skipped 
+        char* sep = strchr(line, ';'); 
+        if (!sep) continue; 
+        *sep = '\0'; 
+
+        if (*num == capacity) 
+        {
+            capacity *= 2; 
+            PerftData* grown = realloc(tests, sizeof(PerftData) * capacity); 
+            if (!grown) 
+            {
+                fprintf(stderr, "Out of memory reading %s\n", path); 
+                for (int i = 0; i < *num; i++) free((char*) tests[i].Fen); 
+                free(tests); 
+                fclose(f); 
+                return NULL; 
+            }
+            tests = grown; 
+        }
+        PerftData* test = &tests[*num]; 
+        memset(test->Expected, 0, sizeof(test->Expected)); 
+        test->Expected[0] = 1; 
+
+        size_t len = strlen(line); 
+        while (len > 0 && isspace((unsigned char) line[len - 1])) line[--len] = '\0'; 
+        char* fen = malloc(len + 1); 
+        memcpy(fen, line, len + 1); 
+        test->Fen = fen; 
+
+        for (char* field = sep + 1; field; field = strchr(field, ';')) 
         {
-            printf("FAILURE: Expected %lu, difference of %ld\n", e, (S64) e - (S64) total); 
-            ret = 0; 
-            // goto cleanup; 
+            if (*field == ';') field++; 
+
+            int depth; 
+            U64 count; 
+            if (sscanf(field, " D%d %" SCNu64, &depth, &count) == 2 && depth >= 1 && depth <= MaxPerftDepth) 
+            {
+                test->Expected[depth] = count; 
+            }
         }
 
-        fflush(stdout); 
+        (*num)++; 
     }
 
-    printf("DONE\n\n"); 
+    fclose(f); 
+    return tests; 
+}
 
-cleanup: 
-    FreeGame(g); 
-    return ret; 
+/**
+ * Prints command line usage. 
+ */
+static void PrintUsage(void) 
+{
+    printf("Usage: perft [options] [suite.epd]\n"); 
+    printf("  -d <depth>    Maximum depth per position (default %d)\n", MaxPerftDepth); 
+    printf("  -t <threads>  Number of threads (default 1)\n"); 
+    printf("  -c <MiB>      Size of the perft cache (default none)\n"); 
+    printf("  -f <format>   Output format: text, csv or json (default text)\n"); 
+    printf("Without a suite, the built in positions are used.\n"); 
 }
 
 PerftData s_Tests[] = 
@@ -234,24 +400,108 @@ PerftData s_Tests[] =
     { .Fen = "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1 ", .Expected = { 1ULL, 24ULL, 496ULL, 9483ULL, 182838ULL, 3605103ULL, 71179139ULL, 0 } }, 
 };
 
-int main(void) 
+int main(int argc, char** argv) 
 {
-    int res = 0; 
+    InitSliderTables(); 
+
+    const char* epdPath = NULL; 
+    int cacheMb = 0; 
+
+    for (int i = 1; i < argc; i++) 
+    {
+        bool hasValue = i + 1 < argc; 
+
+        if (!strcmp(argv[i], "-d") && hasValue) s_MaxDepth = atoi(argv[++i]); 
+        else if (!strcmp(argv[i], "-t") && hasValue) s_Threads = atoi(argv[++i]); 
+        else if (!strcmp(argv[i], "-c") && hasValue) cacheMb = atoi(argv[++i]); 
+        else if (!strcmp(argv[i], "-f") && hasValue) 
+        {
+            i++; 
+            if (!strcmp(argv[i], "text")) s_Format = FormatText; 
+            else if (!strcmp(argv[i], "csv")) s_Format = FormatCsv; 
+            else if (!strcmp(argv[i], "json")) s_Format = FormatJson; 
+            else 
+            {
+                PrintUsage(); 
+                return 1; 
+            }
+        }
+        else if (argv[i][0] != '-' && !epdPath) epdPath = argv[i]; 
+        else 
+        {
+            PrintUsage(); 
+            return 1; 
+        }
+    }
+
+    if (s_Threads < 1) s_Threads = 1; 
+    if (s_MaxDepth > MaxPerftDepth) s_MaxDepth = MaxPerftDepth; 
+
+    PerftData* tests = s_Tests; 
     int N = sizeof(s_Tests) / sizeof(s_Tests[0]); 
+    if (epdPath) 
+    {
+        tests = LoadEpd(epdPath, &N); 
+        if (!tests) return 1; 
+    }
+
+    // the cache is kept for all positions, counts do not depend on the root 
+    PerftCache cache; 
+    if (cacheMb > 0) 
+    {
+        CreatePerftCache(&cache, cacheMb); 
+        s_Cache = &cache; 
+    }
+
+    switch (s_Format) 
+    {
+        case FormatText: 
+            printf("Using %d threads\n", s_Threads); 
+            if (s_Cache) printf("Using %d MiB perft cache\n", cacheMb); 
+            printf("\n"); 
+            break; 
+
+        case FormatCsv: 
+            printf("position,fen,depth,expected,nodes,time_ms,mnps,hit_rate,result\n"); 
+            break; 
+
+        case FormatJson: 
+            printf("{\n  \"engine\": \"%s\",\n  \"threads\": %d,\n  \"cache_mb\": %d,\n  \"max_depth\": %d,\n  \"results\": [", 
+                ENGINE_NAME, s_Threads, cacheMb, s_MaxDepth); 
+            break; 
+    }
 
+    int res = 0; 
     for (int i = 0; i < N; i++) 
     {
-        char name[64]; 
-        snprintf(name, 64, "Position %d / %d", i+1, N); 
+        res += RunPerft(i + 1, N, &tests[i]); 
+    }
 
-        res += RunPerft(name, s_Tests[i].Fen, s_Tests[i].Expected); 
+    double mean = speed.N > 0 ? speed.Total / speed.N / 1000000 : 0; 
+    switch (s_Format) 
+    {
+        case FormatText: 
+            printf("%d / %d passed\n", res, s_Total); 
+            printf("\nSpeed (>%.1fs)\n", MinPerftSpeedTime); 
+            printf("Min: %.2fMnps\n", speed.Slow / 1000000); 
+            printf("Max: %.2fMnps\n", speed.Fast / 1000000); 
+            printf("Mean: %.2fMnps\n", mean); 
+            break; 
+
+        case FormatCsv: 
+            break; 
+
+        case FormatJson: 
+            printf("\n  ],\n  \"passed\": %d,\n  \"total\": %d,\n  \"mean_mnps\": %.3lf\n}\n", res, s_Total, mean); 
+            break; 
     }
 
-    printf("%d / %d passed\n", res, s_Total); 
-    printf("\nSpeed (>%.1fs)\n", MinPerftSpeedTime); 
-    printf("Min: %.2fMnps\n", speed.Slow / 1000000); 
-    printf("Max: %.2fMnps\n", speed.Fast / 1000000); 
-    printf("Mean: %.2fMnps\n", speed.Total / speed.N / 1000000); 
+    if (s_Cache) DestroyPerftCache(s_Cache); 
+    if (epdPath) 
+    {
+        for (int i = 0; i < N; i++) free((char*) tests[i].Fen); 
+        free(tests); 
+    }
 
     return -(res != s_Total); // 0 if succeed
 }
@@ -0,0 +1,41 @@
+/**
+ * @file PerftCache.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Implements the perft transposition cache. 
+ */
+
+#include "PerftCache.h" 
+
+#include <stdint.h> 
+#include <stdlib.h> 
+#include <string.h> 
+
+#include "Bitboard.h" 
+
+/**
+ * Size of a cache line in bytes. 
+ */
+#define CacheLineSize 64 
+
+void CreatePerftCache(PerftCache* pc, U64 sizeInMb) 
+{
+    U64 bucketBytes = sizeof(PerftCacheSlot) * PerftCacheBucketSize; 
+    U64 buckets = (sizeInMb * 1024 * 1024) / bucketBytes; 
+    if (buckets < 1) buckets = 1; 
+    // get highest power of two 
+    pc->Size = 1ULL << MostSigBit(buckets); 
+    pc->Mask = pc->Size - 1; 
+
+    pc->Memory = malloc(pc->Size * bucketBytes + CacheLineSize); 
+    pc->Slots = (PerftCacheSlot*) (((uintptr_t) pc->Memory + CacheLineSize - 1) & ~((uintptr_t) CacheLineSize - 1)); 
+    memset(pc->Slots, 0, pc->Size * bucketBytes); 
+}
+
+void DestroyPerftCache(PerftCache* pc) 
+{
+    free(pc->Memory); 
+}
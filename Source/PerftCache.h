@@ -0,0 +1,129 @@
+/**
+ * @file PerftCache.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Defines the perft transposition cache. 
+ * 
+ * Stores the leaf count of (position, depth) pairs so subtrees that are 
+ * reached by transposition are only counted once. Like the transposition 
+ * table, slots are written without locks and the stored key is XORed with 
+ * the data, so threads can share one cache. 
+ */
+
+#pragma once 
+
+#include <stdatomic.h> 
+#include <stdbool.h> 
+
+#include "Types.h" 
+#include "Zobrist.h" 
+
+/**
+ * Number of slots that share a cache line. 
+ */
+#define PerftCacheBucketSize 4 
+
+/**
+ * Perft transposition cache. 
+ */
+typedef struct PerftCache PerftCache; 
+
+/**
+ * Packed slot as it is stored in the cache. 
+ */
+typedef struct PerftCacheSlot PerftCacheSlot; 
+
+/**
+ * Data layout: 
+ * depth: 0-7 
+ * count: 8-63 
+ */
+struct PerftCacheSlot 
+{
+    atomic_ullong Key; // zobrist key XOR data 
+    atomic_ullong Data; 
+};
+
+struct PerftCache 
+{
+    void* Memory; 
+    PerftCacheSlot* Slots; 
+    U64 Size; // number of buckets 
+    U64 Mask; 
+};
+
+/**
+ * Initializes a cache to a target size. 
+ * 
+ * @param pc The cache 
+ * @param sizeInMb Target size in MiB 
+ */
+void CreatePerftCache(PerftCache* pc, U64 sizeInMb); 
+
+/**
+ * Deinitializes a cache. 
+ * 
+ * @param pc The cache 
+ */
+void DestroyPerftCache(PerftCache* pc); 
+
+/**
+ * Queries the leaf count of a position. 
+ * 
+ * @param pc The cache 
+ * @param key Game state hash 
+ * @param depth Remaining depth 
+ * @param count Output leaf count 
+ * @return True if found, false otherwise 
+ */
+static inline bool FindPerftCount(const PerftCache* pc, Zobrist key, int depth, U64* count) 
+{
+    PerftCacheSlot* bucket = &pc->Slots[(key & pc->Mask) * PerftCacheBucketSize]; 
+
+    for (int i = 0; i < PerftCacheBucketSize; i++) 
+    {
+        U64 data = atomic_load_explicit(&bucket[i].Data, memory_order_relaxed); 
+        U64 check = atomic_load_explicit(&bucket[i].Key, memory_order_relaxed); 
+
+        if ((check ^ data) == key && (int) (data & 255) == depth) 
+        {
+            *count = data >> 8; 
+            return true; 
+        }
+    }
+
+    return false; 
+}
+
+/**
+ * Stores the leaf count of a position, replacing the shallowest slot. 
+ * 
+ * @param pc The cache 
+ * @param key Game state hash 
+ * @param depth Remaining depth (1 to 255) 
+ * @param count Leaf count 
+ */
+static inline void StorePerftCount(PerftCache* pc, Zobrist key, int depth, U64 count) 
+{
+    PerftCacheSlot* bucket = &pc->Slots[(key & pc->Mask) * PerftCacheBucketSize]; 
+
+    int replace = 0; 
+    int shallowest = 256; 
+    for (int i = 0; i < PerftCacheBucketSize; i++) 
+    {
+        // empty slots have depth 0 
+        int slotDepth = (int) (atomic_load_explicit(&bucket[i].Data, memory_order_relaxed) & 255); 
+        if (slotDepth < shallowest) 
+        {
+            shallowest = slotDepth; 
+            replace = i; 
+        }
+    }
+
+    U64 data = (count << 8) | (U64) depth; 
+    atomic_store_explicit(&bucket[replace].Key, key ^ data, memory_order_relaxed); 
+    atomic_store_explicit(&bucket[replace].Data, data, memory_order_relaxed); 
+}
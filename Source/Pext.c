@@ -0,0 +1,149 @@
+/**
+ * @file Pext.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Generates PEXT indexed slider attack tables. 
+ */
+
+#include "Pext.h" 
+
+#include <stdio.h> 
+#include <stdlib.h> 
+
+#include "Square.h" 
+
+#ifdef BMI2
+
+Bitboard PextRSlide[PextRTableSize]; 
+Bitboard PextBSlide[PextBTableSize]; 
+
+U32 PextROffset[NumSquares]; 
+U32 PextBOffset[NumSquares]; 
+
+static const int RDirs[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } }; 
+static const int BDirs[4][2] = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } }; 
+
+/**
+ * Slowly computes slider attacks by walking each ray until it is blocked. 
+ * 
+ * @param sq Square of the slider 
+ * @param occ All pieces on the board 
+ * @param dirs File and rank step of each ray 
+ * @return Attacked squares, including the first blocker of each ray 
+ */
+static Bitboard WalkRays(Square sq, Bitboard occ, const int dirs[4][2]) 
+{
+    Bitboard attacks = 0; 
+
+    for (int d = 0; d < 4; d++) 
+    {
+        int file = GetFile(sq) + dirs[d][0]; 
+        int rank = GetRank(sq) + dirs[d][1]; 
+
+        while (file >= 0 && file < 8 && rank >= 0 && rank < 8) 
+        {
+            Bitboard b = Bits[MakeSquare(file, rank)]; 
+            attacks |= b; 
+            if (occ & b) break; 
+
+            file += dirs[d][0]; 
+            rank += dirs[d][1]; 
+        }
+    }
+
+    return attacks; 
+}
+
+/**
+ * Fills the attack sets of one slider type. 
+ * 
+ * @param slide Output attack sets 
+ * @param offset Output start of each square's attack sets 
+ * @param masks Relevant occupancy of each square 
+ * @param dirs File and rank step of each ray 
+ * @param size Number of attack sets 
+ */
+static void InitPextTable(Bitboard* slide, U32* offset, const Bitboard* masks, const int dirs[4][2], U32 size) 
+{
+    U32 next = 0; 
+
+    for (Square sq = 0; sq < NumSquares; sq++) 
+    {
+        offset[sq] = next; 
+
+        // carry-rippler visits the subsets in the same order as their PEXT index 
+        Bitboard sub = 0; 
+        do 
+        {
+            slide[next++] = WalkRays(sq, sub, dirs); 
+            sub = (sub - masks[sq]) & masks[sq]; 
+        }
+        while (sub); 
+    }
+
+    if (next != size) 
+    {
+        printf("info string slider table has %u entries, expected %u\n", next, size); 
+        exit(1); 
+    }
+}
+
+#ifdef VALIDATION
+/**
+ * Checks that every PEXT attack set equals the magic attack set. 
+ */
+static void ValidatePextTables(void) 
+{
+    for (Square sq = 0; sq < NumSquares; sq++) 
+    {
+        Bitboard sub = 0; 
+        do 
+        {
+            Bitboard rPext = PextRSlide[PextROffset[sq] + _pext_u64(sub, MagicRMask[sq])]; 
+            Bitboard rMagic = MagicRSlide[sq][(sub * MagicR[sq]) >> MagicRShift[sq]]; 
+            if (rPext != rMagic) 
+            {
+                printf("info string rook PEXT attacks differ from magic on square %d\n", (int) sq); 
+                exit(1); 
+            }
+            sub = (sub - MagicRMask[sq]) & MagicRMask[sq]; 
+        }
+        while (sub); 
+
+        do 
+        {
+            Bitboard bPext = PextBSlide[PextBOffset[sq] + _pext_u64(sub, MagicBMask[sq])]; 
+            Bitboard bMagic = MagicBSlide[sq][(sub * MagicB[sq]) >> MagicBShift[sq]]; 
+            if (bPext != bMagic) 
+            {
+                printf("info string bishop PEXT attacks differ from magic on square %d\n", (int) sq); 
+                exit(1); 
+            }
+            sub = (sub - MagicBMask[sq]) & MagicBMask[sq]; 
+        }
+        while (sub); 
+    }
+}
+#endif
+
+void InitSliderTables(void) 
+{
+    InitPextTable(PextRSlide, PextROffset, MagicRMask, RDirs, PextRTableSize); 
+    InitPextTable(PextBSlide, PextBOffset, MagicBMask, BDirs, PextBTableSize); 
+
+#ifdef VALIDATION
+    ValidatePextTables(); 
+#endif
+}
+
+#else
+
+void InitSliderTables(void) 
+{
+    // magic tables are stored in the executable 
+}
+
+#endif
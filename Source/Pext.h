@@ -0,0 +1,45 @@
+/**
+ * @file Pext.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * PEXT indexed slider attack tables. 
+ * 
+ * With BMI2, the relevant occupancy of a slider is compressed with PEXT 
+ * into a dense index, so no magic multiplier or shift is needed. The 
+ * tables are generated at startup. Builds without BMI2 use the magic 
+ * tables from Magic.h instead. 
+ */
+
+#pragma once 
+
+#include "Bitboard.h" 
+#include "Magic.h" 
+
+#ifdef BMI2
+#include <immintrin.h> 
+
+/**
+ * Number of rook attack sets over all squares. 
+ */
+#define PextRTableSize 102400 
+
+/**
+ * Number of bishop attack sets over all squares. 
+ */
+#define PextBTableSize 5248 
+
+extern Bitboard PextRSlide[PextRTableSize]; 
+extern Bitboard PextBSlide[PextBTableSize]; 
+
+extern U32 PextROffset[NumSquares]; 
+extern U32 PextBOffset[NumSquares]; 
+#endif
+
+/**
+ * Generates slider attack tables that are not stored in the executable. 
+ * Must be called once at startup before any move generation. 
+ */
+void InitSliderTables(void); 
@@ -21,7 +21,13 @@
 /**
  * How often we should check for being out of time. 
  */
-#define CheckTimeThreshold 100000
+#define CheckTimeThreshold 4096 
+
+/**
+ * Move order value added to captures that lose material. 
+ * Always lower than any other tactical move. 
+ */
+#define LosingCaptureValue (-500000) 
 
 /**
  * Simplified piece values for move ordering. 
@@ -38,69 +44,161 @@ static const int PieceValues[] =
 static bool NoHandleTime = false; 
 
 /**
- * Checks if search should stop due to time. 
- * 
- * @param ctx Search context 
- * @return True if out of time
+ * @param num Number of seconds 
+ * @return What the time will be `num` seconds from now 
  */
-static inline bool IsOutOfTime(const SearchContext* ctx) 
+static inline TimePoint NSecondsFromNow(int num) 
 {
-    // need at least depth 1
-    return ctx->BestLine.NumMoves && (ctx->ShouldExit || (ctx->TargetTimeMs >= 0 && clock() > ctx->EndAt)); 
+    return GetTimeMs() + num * 1000; 
 }
 
 /**
- * @param num Number of seconds 
- * @return What the time will be `num` seconds from now 
+ * @param ctx Search context 
+ * @return Total nodes searched by all threads 
  */
-static inline clock_t NSecondsFromNow(int num) 
+static inline U64 GetSearchNodes(const SearchContext* ctx) 
 {
-    return clock() + num * CLOCKS_PER_SEC; 
+    U64 nodes = 0; 
+    for (int i = 0; i < ctx->NumThreads; i++) 
+    {
+        nodes += ctx->Threads[i].State->Nodes; 
+    }
+    return nodes; 
 }
 
 /**
- * Quit the search if the alloted time has run out. 
- * 
- * If search is out of time, the current best move will be printed and the thread will exit. 
+ * Tells helper threads to stop and waits for them to go idle. 
+ * Must only be called by the main search thread. 
  * 
  * @param ctx Search context 
- * @return True if out of time and thread is exiting
  */
-static inline bool HandleOutOfTime(SearchContext* ctx) 
+static void StopHelperThreads(SearchContext* ctx) 
 {
-    // only check every so often to reduce affect on search speed 
-    if (ctx->CheckTime++ < CheckTimeThreshold || NoHandleTime) return false; 
+    atomic_store_explicit(&ctx->ShouldExit, true, memory_order_relaxed); 
 
-    ctx->CheckTime = 0; 
-
-    // check for time limit
-    if (IsOutOfTime(ctx)) 
+    pthread_mutex_lock(&ctx->Lock); 
+    for (int i = 1; i < ctx->NumThreads; i++) 
     {
-        if (ctx->BestLine.NumMoves) 
+        while (ctx->Threads[i].Searching) 
         {
-            printf("bestmove "); 
-            PrintMoveEnd(ctx->BestLine.Moves[0], "\n"); 
-            fflush(stdout); 
+            pthread_cond_wait(&ctx->DoneCond, &ctx->Lock); 
         }
-        else 
+    }
+    pthread_mutex_unlock(&ctx->Lock); 
+}
+
+/**
+ * Picks the best result out of all search threads and prints it. 
+ * Helper threads must be stopped before calling this. 
+ * 
+ * @param ctx Search context 
+ */
+static void PrintBestMove(SearchContext* ctx) 
+{
+    // prefer a helper's line only if it finished a deeper iteration 
+    const SearchThread* best = &ctx->Threads[0]; 
+    for (int i = 1; i < ctx->NumThreads; i++) 
+    {
+        const SearchThread* helper = &ctx->Threads[i]; 
+        if (helper->BestLine.NumMoves && helper->Depth > best->Depth) 
         {
-            // no best move 
-            printf("bestmove a1a1\n"); 
-            fflush(stdout); 
+            best = helper; 
         }
+    }
+
+    if (best != &ctx->Threads[0]) 
+    {
+        ctx->BestLine = best->BestLine; 
+        ctx->Depth = best->Depth; 
+        ctx->Eval = best->Eval; 
+    }
+    ctx->Nodes = GetSearchNodes(ctx); 
+    ctx->PawnProbes = 0; 
+    ctx->PawnHits = 0; 
+    ctx->EvalProbes = 0; 
+    ctx->EvalHits = 0; 
+    for (int i = 0; i < ctx->NumThreads; i++) 
+    {
+        ctx->PawnProbes += ctx->Threads[i].Pawns.Probes; 
+        ctx->PawnHits += ctx->Threads[i].Pawns.Hits; 
+        ctx->EvalProbes += ctx->Threads[i].Evals.Probes; 
+        ctx->EvalHits += ctx->Threads[i].Evals.Hits; 
+    }
+
+    if (ctx->Silent) return; 
+
+    if (ctx->PawnProbes) 
+    {
+        printf("info string pawn hash hits %.1f%%\n", 100.0 * ctx->PawnHits / ctx->PawnProbes); 
+    }
+    if (ctx->EvalProbes) 
+    {
+        printf("info string eval cache hits %.1f%%\n", 100.0 * ctx->EvalHits / ctx->EvalProbes); 
+    }
+
+    if (ctx->BestLine.NumMoves) 
+    {
+        printf("bestmove "); 
+        PrintMoveEnd(ctx->BestLine.Moves[0], "\n"); 
+    }
+    else 
+    {
+        // no best move 
+        printf("bestmove a1a1\n"); 
+    }
+    fflush(stdout); 
+}
+
+/**
+ * Checks if the search should stop. Must be called once per node. 
+ * 
+ * Every thread stops as soon as the stop flag is set. The main thread also 
+ * checks the time limit every so often and sets the flag when it runs out. 
+ * Once this returns true it keeps returning true, so callers can unwind 
+ * the search without doing any more work. 
+ * 
+ * @param thread Search thread 
+ * @return True if the search is stopping 
+ */
+static inline bool ShouldStopSearch(SearchThread* thread) 
+{
+    SearchContext* ctx = thread->Context; 
+
+    if (thread->Stopped) return true; 
 
-        pthread_exit(NULL); 
+    // main thread needs at least depth 1 to have a move to play 
+    if (thread->Id == 0 && !ctx->BestLine.NumMoves) return false; 
+
+    if (atomic_load_explicit(&ctx->ShouldExit, memory_order_relaxed)) 
+    {
+        thread->Stopped = true; 
+        return true; 
+    }
+
+    // helpers are stopped by the main thread 
+    if (thread->Id != 0) return false; 
+
+    // only check every so often to reduce affect on search speed 
+    if (thread->CheckTime++ < CheckTimeThreshold || NoHandleTime) return false; 
+
+    thread->CheckTime = 0; 
+
+    // check for time limit
+    if (IsHardLimitReached(&ctx->Time)) 
+    {
+        atomic_store_explicit(&ctx->ShouldExit, true, memory_order_relaxed); 
+        thread->Stopped = true; 
         return true; 
     }
 
     // if next depth is taking too long send occasional updates 
-    clock_t curTime = clock(); 
-    if (curTime >= ctx->NextMessageAt) 
+    TimePoint curTime = GetTimeMs(); 
+    if (curTime >= ctx->NextMessageAt && !ctx->Silent) 
     {
-        U64 nodes = ctx->State->Nodes; 
-        double dur = (double) (curTime - ctx->StartAt) / CLOCKS_PER_SEC; 
+        U64 nodes = GetSearchNodes(ctx); 
+        double dur = (double) (curTime - ctx->StartAt) / 1000; 
         double nps = nodes / dur; 
-        printf("info depth %d time %.0f nodes %" PRIu64 " nps %.0f hashfull %" PRIu64 "\n", ctx->Depth+1, dur*1000, nodes, nps, 1000*ctx->Transpositions.Used/ctx->Transpositions.Size);
+        printf("info depth %d time %.0f nodes %" PRIu64 " nps %.0f hashfull %d\n", ctx->Depth+1, dur*1000, nodes, nps, GetTTableHashfull(&ctx->Transpositions));
         fflush(stdout); 
         ctx->NextMessageAt = NSecondsFromNow(1); 
     }
@@ -113,13 +211,13 @@ static inline bool HandleOutOfTime(SearchContext* ctx)
  * 
  * Moves are assumed to be captures, don't call this function if they are not. 
  * 
- * @param ctx Search context
+ * @param thread Search thread
  * @param mv The move
  * @return MVV-LVA value
  */
-static inline int MvvLva(SearchContext* ctx, Move mv) 
+static inline int MvvLva(SearchThread* thread, Move mv) 
 {
-    (void) ctx; 
+    (void) thread; 
     PieceType pcType = TypeOfPiece(FromPiece(mv)); 
     PieceType tgtType = TypeOfPiece(TargetPiece(mv));
     return 10 * (PieceValues[tgtType] - PieceValues[pcType]); 
@@ -128,12 +226,12 @@ static inline int MvvLva(SearchContext* ctx, Move mv)
 /**
  * Move ordering values for qsearch. 
  * 
- * @param ctx Search context 
+ * @param thread Search thread 
  * @param mv The move
  * @param hashMove TT move for the board position
  * @return Move value where higher values should come first 
  */
-static inline int QMoveVal(SearchContext* ctx, Move mv, Move hashMove) 
+static inline int QMoveVal(SearchThread* thread, Move mv, Move hashMove) 
 {
     // push quiet moves to the end
     if (IsQuiet(mv)) return -1000000; 
@@ -143,10 +241,11 @@ static inline int QMoveVal(SearchContext* ctx, Move mv, Move hashMove)
 
     int val = 0; 
 
-    // order captures by MVV-LVA 
+    // order captures by MVV-LVA, losing captures last 
     if (IsCapture(mv)) 
     {
-        val += MvvLva(ctx, mv); 
+        val += MvvLva(thread, mv); 
+        if (!SeeAtLeast(thread->State, mv, 0)) val += LosingCaptureValue; 
     }
 
     // promotions 
@@ -165,61 +264,28 @@ static inline int QMoveVal(SearchContext* ctx, Move mv, Move hashMove)
 }
 
 /**
- * Move ordering values for negamax search. 
+ * Move ordering values for quiet moves in negamax search. 
+ * Captures and promotions are ordered separately with `QMoveVal`. 
  * 
- * @param ctx Search context 
+ * @param thread Search thread 
  * @param mv The move
- * @param hashMove TT move for the board position
+ * @param hashMove Unused 
  * @return Move value where higher values should come first 
  */
-static inline int MoveVal(SearchContext* ctx, Move mv, Move hashMove) 
+static inline int QuietMoveVal(SearchThread* thread, Move mv, Move hashMove) 
 {
-    Game* g = ctx->State; 
+    (void) hashMove; 
+
+    Game* g = thread->State; 
     PieceType pcType = TypeOfPiece(FromPiece(mv)); 
 
     int add = IsCheck(mv) * 1000000; 
 
-    // previous pv has highest priority 
-    // first move is ply 1, not ply 0
-    // so check <= instead of <
-    if (ctx->InPV && ctx->Ply <= (S64) ctx->BestLine.NumMoves) 
-    {
-        if (mv == ctx->BestLine.Moves[ctx->Ply - 1]) return 999999999 + add;  
-    }
-
-    if (mv == hashMove) return 999999998; 
-
-    // capture
-    if (IsCapture(mv)) 
-    {
-        return 100000 + MvvLva(ctx, mv) + add; 
-    }
-
-    bool q = IsQuiet(mv); 
-    if (q) 
-    {
-        // killer move 
-        if (ctx->Killer[ctx->Ply][0] == mv) 
-        {
-            return 100001 + add; 
-        }
-        if (ctx->Killer[ctx->Ply][1] == mv) 
-        {
-            return 100000 + add; 
-        }
-
-        // history heuristic 
-        int hist = ctx->History[g->Turn][pcType][ToSquare(mv)]; 
-        if (hist > 0) 
-        {
-            return hist + add; 
-        }
-    }
-    
-    // promotion
-    if (IsPromotion(mv)) 
+    // history heuristic 
+    int hist = thread->History[g->Turn][pcType][ToSquare(mv)]; 
+    if (hist > 0) 
     {
-        return PieceValues[TypeOfPiece(PromotionPiece(mv))] + add; 
+        return hist + add; 
     }
 
     // default 
@@ -237,19 +303,17 @@ static inline int MoveVal(SearchContext* ctx, Move mv, Move hashMove)
  * Compute move order values for all moves. 
  * This does not sort moves. 
  * 
- * @param ctx Search context 
+ * @param thread Search thread 
+ * @param moves Move list 
  * @param start Start index 
  * @param hashMove TT move 
  * @param moveVal Function for determining move order value 
- * @param values Output for move values
  */
-static inline void GetMoveOrder(SearchContext* ctx, U64 start, Move hashMove, int (*moveVal)(SearchContext*,Move,Move), int* values) 
+static inline void GetMoveOrder(SearchThread* thread, MoveList* moves, U64 start, Move hashMove, int (*moveVal)(SearchThread*,Move,Move)) 
 {
-    MoveList* moves = ctx->Moves; 
-
     for (U64 i = start; i < moves->Size; i++) 
     {
-        *(values++) = moveVal(ctx, moves->Moves[i], hashMove); 
+        moves->Moves[i].Value = moveVal(thread, moves->Moves[i].Mv, hashMove); 
     }
 }
 
@@ -257,21 +321,18 @@ static inline void GetMoveOrder(SearchContext* ctx, U64 start, Move hashMove, in
  * Finds the next move with the highest move order value. 
  * Move values should already be computed with `GetMoveOrder`. 
  * 
- * @param ctx Search context 
+ * @param moves Move list 
  * @param start Start index 
- * @param values Input/output for move values 
- * @return 
+ * @return The move, which is now at the start index 
  */
-static inline Move NextMove(SearchContext* ctx, U64 start, int* values) 
+static inline Move NextMove(MoveList* moves, U64 start) 
 {
-    MoveList* moves = ctx->Moves; 
-
     // swap current index with highest priority move 
     U64 bestI = start; 
-    int bestVal = values[0]; 
+    int bestVal = moves->Moves[start].Value; 
     for (U64 i = start + 1; i < moves->Size; i++) 
     {
-        int val = values[i - start]; 
+        int val = moves->Moves[i].Value; 
         
         if (val > bestVal) 
         {
@@ -283,45 +344,215 @@ static inline Move NextMove(SearchContext* ctx, U64 start, int* values)
     // put best move in first place and return it 
     SwapMoves(moves, start, bestI); 
 
-    // swap move value too 
-    values[bestI - start] = values[0]; 
-    values[0] = bestVal; 
+    return moves->Moves[start].Mv; 
+}
+
+/**
+ * Initializes a move picker. 
+ * `Info` must already be generated for the current position. 
+ * 
+ * @param thread Search thread 
+ * @param mp The picker 
+ * @param hashMove TT move for the board position 
+ */
+static inline void InitMovePicker(SearchThread* thread, MovePicker* mp, Move hashMove) 
+{
+    mp->Stage = PickPV; 
+    ClearMoves(&mp->Moves); 
+    mp->Next = 0; 
+    mp->NumTried = 0; 
+    mp->HashMove = hashMove; 
+
+    // previous pv has highest priority 
+    // first move is ply 1, not ply 0 
+    // so check <= instead of < 
+    mp->PVMove = NoMove; 
+    if (thread->InPV && thread->Ply <= (S64) thread->BestLine.NumMoves) 
+    {
+        mp->PVMove = thread->BestLine.Moves[thread->Ply - 1]; 
+    }
+}
+
+/**
+ * Checks if a move was already returned by an early stage. 
+ * 
+ * @param mp The picker 
+ * @param mv The move 
+ * @return True if the move should be skipped 
+ */
+static inline bool WasMoveTried(const MovePicker* mp, Move mv) 
+{
+    for (int i = 0; i < mp->NumTried; i++) 
+    {
+        if (IsSameMove(mp->Tried[i], mv)) return true; 
+    }
+    return false; 
+}
+
+/**
+ * Validates a move that was not generated for this position. 
+ * 
+ * @param thread Search thread 
+ * @param mp The picker 
+ * @param mv The move (or NoMove) 
+ * @return Legal move with flags for this position, or NoMove 
+ */
+static inline Move TryPickMove(SearchThread* thread, MovePicker* mp, Move mv) 
+{
+    if (mv == NoMove || WasMoveTried(mp, mv)) return NoMove; 
+
+    mv = FindLegalMove(thread->State, &mp->Info, mv, &mp->Moves); 
+    if (mv != NoMove) 
+    {
+        mp->Tried[mp->NumTried++] = mv; 
+    }
+    return mv; 
+}
+
+/**
+ * Lists moves for a stage after the current end of the list and computes 
+ * their move order values. 
+ * 
+ * @param thread Search thread 
+ * @param mp The picker 
+ * @param mask Allowed target squares for pieces other than pawns 
+ * @param pawnMask Allowed target squares for pawns 
+ * @param moveVal Function for determining move order value 
+ */
+static inline void GenPickerMoves(SearchThread* thread, MovePicker* mp, Bitboard mask, Bitboard pawnMask, int (*moveVal)(SearchThread*,Move,Move)) 
+{
+    mp->Next = mp->Moves.Size; 
+    GenMovesFromInfoMask(thread->State, &mp->Info, mask, pawnMask, &mp->Moves); 
+    GetMoveOrder(thread, &mp->Moves, mp->Next, NoMove, moveVal); 
+}
+
+/**
+ * Gets the next listed move of the current stage. 
+ * 
+ * @param mp The picker 
+ * @param minValue Moves with a lower move order value are left in the list 
+ * @return The move or NoMove if the stage has no moves left 
+ */
+static inline Move NextListedMove(MovePicker* mp, int minValue) 
+{
+    while (mp->Next < mp->Moves.Size) 
+    {
+        Move mv = NextMove(&mp->Moves, mp->Next); 
+        if (mp->Moves.Moves[mp->Next].Value < minValue) return NoMove; 
+        mp->Next++; 
+
+        if (!WasMoveTried(mp, mv)) return mv; 
+    }
+    return NoMove; 
+}
+
+/**
+ * Gets the next move to search. Moves are only generated once a stage 
+ * needs them, so a cutoff from the TT move skips listing moves entirely. 
+ * 
+ * @param thread Search thread 
+ * @param mp The picker 
+ * @return The move or NoMove if there are no moves left 
+ */
+static inline Move NextPickedMove(SearchThread* thread, MovePicker* mp) 
+{
+    Bitboard mask, pawnMask; 
+    Move mv; 
 
-    return moves->Moves[start]; 
+    switch (mp->Stage) 
+    {
+        case PickPV: 
+            mp->Stage = PickHash; 
+            if ((mv = TryPickMove(thread, mp, mp->PVMove))) return mv; 
+            // fall through 
+        case PickHash: 
+            mp->Stage = PickGenTactical; 
+            if ((mv = TryPickMove(thread, mp, mp->HashMove))) return mv; 
+            // fall through 
+        case PickGenTactical: 
+            GetTacticalMasks(thread->State, &mask, &pawnMask); 
+            GenPickerMoves(thread, mp, mask, pawnMask, QMoveVal); 
+            mp->Stage = PickTactical; 
+            // fall through 
+        case PickTactical: 
+            if ((mv = NextListedMove(mp, LosingCaptureValue / 2))) return mv; 
+            // losing captures stay in the list until quiet moves are done 
+            mp->BadStart = mp->Next; 
+            mp->BadEnd = mp->Moves.Size; 
+            mp->Stage = PickKiller1; 
+            // fall through 
+        case PickKiller1: 
+            mp->Stage = PickKiller2; 
+            if ((mv = TryPickMove(thread, mp, thread->Killer[thread->Ply][0]))) return mv; 
+            // fall through 
+        case PickKiller2: 
+            mp->Stage = PickGenQuiet; 
+            if ((mv = TryPickMove(thread, mp, thread->Killer[thread->Ply][1]))) return mv; 
+            // fall through 
+        case PickGenQuiet: 
+            GetTacticalMasks(thread->State, &mask, &pawnMask); 
+            GenPickerMoves(thread, mp, ~mask, ~pawnMask, QuietMoveVal); 
+            mp->Stage = PickQuiet; 
+            // fall through 
+        case PickQuiet: 
+            if ((mv = NextListedMove(mp, INT_MIN))) return mv; 
+            PopMovesToSize(&mp->Moves, mp->BadEnd); 
+            mp->Next = mp->BadStart; 
+            mp->Stage = PickBadTactical; 
+            // fall through 
+        case PickBadTactical: 
+            if ((mv = NextListedMove(mp, INT_MIN))) return mv; 
+            mp->Stage = PickDone; 
+            // fall through 
+        default: 
+            return NoMove; 
+    }
 }
 
 /**
  * Continues search to make positions quiet and then returns board evaluation. 
  * 
- * @param ctx Search context 
+ * @param thread Search thread 
  * @param alpha Lower bound score 
  * @param beta Upper bound score 
  * @param depth Remaining depth to search 
  * @return Quiescence search evaluation
  */
-static inline int QSearch(SearchContext* ctx, int alpha, int beta, int depth) 
+static inline int QSearch(SearchThread* thread, int alpha, int beta, int depth) 
 {
-    Game* g = ctx->State; 
-    MoveList* moves = ctx->Moves; 
-    U64 start = moves->Size; 
+    Game* g = thread->State; 
 
-    ctx->NumQNodes++; 
+    thread->NumQNodes++; 
 
-    HandleOutOfTime(ctx); 
+    if (ShouldStopSearch(thread)) return 0; 
 
     // no further moves are possible 
     bool draw = IsSpecialDraw(g); 
-    if (draw) return -ctx->ColorContempt * ColorSign(g->Turn); 
+    if (draw) return -thread->Context->ColorContempt * ColorSign(g->Turn); 
 
-    GenMoves(g, moves); 
-    U64 numMoves = moves->Size - start; 
+    // evaluation only needs to know if the game is over 
+    bool hasMoves = HasLegalMoves(g); 
 
-    int standPat = ColorSign(g->Turn) * Evaluate(g, ctx->Ply, numMoves, draw, -ctx->ColorContempt); 
+    int standPat; 
+    if (hasMoves) 
+    {
+        // only the regular evaluation is cached, mate scores depend on ply 
+        int eval; 
+        if (!FindCachedEval(&thread->Evals, g->Hash, &eval)) 
+        {
+            eval = Evaluate(g, &thread->Pawns, &thread->Materials, thread->Ply, hasMoves, draw, -thread->Context->ColorContempt); 
+            StoreCachedEval(&thread->Evals, g->Hash, eval); 
+        }
+        standPat = ColorSign(g->Turn) * eval; 
+    }
+    else 
+    {
+        standPat = ColorSign(g->Turn) * Evaluate(g, &thread->Pawns, &thread->Materials, thread->Ply, hasMoves, draw, -thread->Context->ColorContempt); 
+    }
 
     // check for beta cutoff
     if (standPat >= beta) 
     {
-        PopMovesToSize(moves, start); 
         return beta; 
     }
     
@@ -334,42 +565,48 @@ static inline int QSearch(SearchContext* ctx, int alpha, int beta, int depth)
     // leaf node 
     if (depth <= 0) 
     {
-        ctx->NumQLeaves++; 
-        PopMovesToSize(moves, start); 
+        thread->NumQLeaves++; 
         return alpha; 
     }
 
     // check if position has a TT move 
-    TTableEntry* entry = FindTTableEntry(&ctx->Transpositions, g->Hash, g); 
-    Move hashMove = entry ? entry->Mv : NoMove; 
+    TTableEntry entry; 
+    bool found = FindTTableEntry(&thread->Context->Transpositions, g->Hash, &entry, g); 
+    Move hashMove = found ? entry.Mv : NoMove; 
 
     // search tactical moves 
     bool foundMove = false; 
-    if (!draw) 
+    if (hasMoves) 
     {
-        ctx->Ply++; 
-        int moveValues[moves->Size - start]; 
-        GetMoveOrder(ctx, start, hashMove, QMoveVal, moveValues); 
-        for (U64 i = start; i < moves->Size; i++) 
+        // quiescence search takes the place of the main search at this ply 
+        MoveList* moves = &thread->Pickers[thread->Ply].Moves; 
+        ClearMoves(moves); 
+        GenTacticalMoves(g, moves); 
+
+        thread->Ply++; 
+        GetMoveOrder(thread, moves, 0, hashMove, QMoveVal); 
+        for (U64 i = 0; i < moves->Size; i++) 
         {
-            Move mv = NextMove(ctx, i, moveValues + (i - start)); 
+            Move mv = NextMove(moves, i); 
 
-            bool shouldSearch = IsTactical(mv); 
-            if (!shouldSearch) continue; 
+            // skip captures that lose material unless they give check 
+            if (moves->Moves[i].Value < LosingCaptureValue / 2 && !IsCheck(mv)) continue; 
 
             // there are 1+ tactical moves, so not a leaf node 
             foundMove = true; 
 
             // search move 
             PushMove(g, mv); 
-            int score = -QSearch(ctx, -beta, -alpha, depth - 1); 
+            int score = -QSearch(thread, -beta, -alpha, depth - 1); 
             PopMove(g, mv); 
 
+            // score is meaningless if search was stopped 
+            if (thread->Stopped) break; 
+
             // beta cutoff 
             if (score >= beta) 
             {
-                ctx->Ply--; 
-                PopMovesToSize(moves, start); 
+                thread->Ply--; 
                 return beta; 
             }
 
@@ -379,25 +616,29 @@ static inline int QSearch(SearchContext* ctx, int alpha, int beta, int depth)
                 alpha = score; 
             }
         }
-        ctx->Ply--; 
+        thread->Ply--; 
+    }
+    if (!foundMove) thread->NumQLeaves++; 
+
+    if (thread->Stopped) 
+    {
+        return 0; 
     }
-    if (!foundMove) ctx->NumQLeaves++; 
 
-    PopMovesToSize(moves, start); 
     return alpha; 
 }
 
 /**
  * Adds a new move to the current principal variation. 
  * 
- * @param ctx Search context 
+ * @param thread Search thread 
  * @param mv Move to add 
  * @param offset Offset from current ply 
  */
-static inline void UpdatePV(SearchContext* ctx, Move mv, int offset) 
+static inline void UpdatePV(SearchThread* thread, Move mv, int offset) 
 {
-    PVLine* dst = ctx->Lines + ctx->Ply + offset; 
-    PVLine* src = ctx->Lines + ctx->Ply + 1 + offset; 
+    PVLine* dst = thread->Lines + thread->Ply + offset; 
+    PVLine* src = thread->Lines + thread->Ply + 1 + offset; 
 
     dst->Moves[0] = mv; 
     memcpy(dst->Moves + 1, src->Moves, src->NumMoves * sizeof(Move)); 
@@ -407,12 +648,12 @@ static inline void UpdatePV(SearchContext* ctx, Move mv, int offset)
 /**
  * Clears the principal variation. 
  * 
- * @param ctx Search context 
+ * @param thread Search thread 
  * @param offset Offset from current ply 
  */
-static inline void ClearPV(SearchContext* ctx, int offset) 
+static inline void ClearPV(SearchThread* thread, int offset) 
 {
-    ctx->Lines[ctx->Ply + offset].NumMoves = 0; 
+    thread->Lines[thread->Ply + offset].NumMoves = 0; 
 }
 
 /**
@@ -426,17 +667,15 @@ static inline void ClearPV(SearchContext* ctx, int offset)
     /* - Ply */ \
     /* - InPV */ \
 \
-    ctx->Ply++; \
+    thread->Ply++; \
     Move bestMove = NoMove; \
     int score = -MaxScore; \
     bool foundPV = false; \
-    bool nodeInPV = ctx->InPV; \
-    int moveValues[moves->Size - start]; \
-    GetMoveOrder(ctx, start, hashMove, MoveVal, moveValues); \
-    for (U64 i = start; i < moves->Size; i++) \
+    bool nodeInPV = thread->InPV; \
+    InitMovePicker(thread, picker, hashMove); \
+    Move mv; \
+    for (int moveNum = 0; (mv = NextPickedMove(thread, picker)) != NoMove; moveNum++) \
     {\
-        Move mv = NextMove(ctx, i, moveValues + (i - start)); \
-\
         onMove; \
 \
         bool capture = IsCapture(mv); \
@@ -455,14 +694,14 @@ static inline void ClearPV(SearchContext* ctx, int offset)
         lmr &= !pro; \
         lmr &= !check; \
         lmr &= !givesCheck; \
-        lmr &= i - start >= 4; \
+        lmr &= moveNum >= 4; \
         lmr &= depth > 3; \
         int lmrAmt = lmr * 2; \
 \
         if (!check && !givesCheck && foundPV) /* principal variation search */ \
         {\
             /* check if the move is at all better than current best */ \
-            score = -Negamax_(ctx, -alpha - 1, -alpha, depth - 1 - lmrAmt); \
+            score = -Negamax_(thread, -alpha - 1, -alpha, depth - 1 - lmrAmt); \
 \
             if (score <= alpha || score >= beta) \
             {\
@@ -471,7 +710,7 @@ static inline void ClearPV(SearchContext* ctx, int offset)
         }\
         else if (lmr) /* late move reduction */ \
         {\
-            score = -Negamax_(ctx, -alpha - 1, -alpha, depth - 1 - lmrAmt); \
+            score = -Negamax_(thread, -alpha - 1, -alpha, depth - 1 - lmrAmt); \
         \
             if (score <= alpha || score >= beta) \
             {\
@@ -481,10 +720,13 @@ static inline void ClearPV(SearchContext* ctx, int offset)
 \
         if (fullSearch) \
         {\
-            score = -Negamax_(ctx, -beta, -alpha, depth - 1); \
+            score = -Negamax_(thread, -beta, -alpha, depth - 1); \
         }\
         \
         PopMove(g, mv); \
+\
+        /* score is meaningless if search was stopped */ \
+        if (thread->Stopped) break; \
 \
         /* beta cutoff */ \
         if (score >= beta) \
@@ -492,14 +734,14 @@ static inline void ClearPV(SearchContext* ctx, int offset)
             if (IsQuiet(mv)) \
             {\
                 /* killer move heuristic */ \
-                if (ctx->Killer[ctx->Ply][0] != mv) \
+                if (thread->Killer[thread->Ply][0] != mv) \
                 {\
-                    ctx->Killer[ctx->Ply][1] = ctx->Killer[ctx->Ply][0]; \
-                    ctx->Killer[ctx->Ply][0] = mv; \
+                    thread->Killer[thread->Ply][1] = thread->Killer[thread->Ply][0]; \
+                    thread->Killer[thread->Ply][0] = mv; \
                 }\
 \
                 /* history heuristic */ \
-                ctx->History[g->Turn][TypeOfPiece(FromPiece(mv))][ToSquare(mv)] = depth * depth; \
+                thread->History[g->Turn][TypeOfPiece(FromPiece(mv))][ToSquare(mv)] = depth * depth; \
             }\
 \
             alpha = beta; \
@@ -512,96 +754,104 @@ static inline void ClearPV(SearchContext* ctx, int offset)
         {\
             foundPV = true; \
             alpha = score; \
-            UpdatePV(ctx, mv, -1); /* ply is incremented right now: -1 offset */ \
+            UpdatePV(thread, mv, -1); /* ply is incremented right now: -1 offset */ \
             bestMove = mv; \
         }\
 \
         /* only way to be in previous PV is to be the leftmost node */ \
-        ctx->InPV = false; \
+        thread->InPV = false; \
     } \
-    ctx->Ply--; \
-    ctx->InPV = nodeInPV; 
+    thread->Ply--; \
+    thread->InPV = nodeInPV; 
 
 /**
  * Negamax for non-root nodes. 
  * Call `Negamax` instead. 
  * 
- * @param ctx Search context
+ * @param thread Search thread
  * @param alpha Lower bound
  * @param beta Upper bound 
  * @param depth Remaining depth 
  * @return Evaluation
  */
-static inline int Negamax_(SearchContext* ctx, int alpha, int beta, int depth) 
+static inline int Negamax_(SearchThread* thread, int alpha, int beta, int depth) 
 {
     // init node 
-    ClearPV(ctx, 0); 
-    ctx->NumNodes++; 
+    ClearPV(thread, 0); 
+    thread->NumNodes++; 
 
     // break out if search should end 
-    HandleOutOfTime(ctx); 
+    if (ShouldStopSearch(thread)) return 0; 
 
-    Game* g = ctx->State; 
-    MoveList* moves = ctx->Moves; 
-    U64 start = moves->Size; 
-
-    int alphaOrig = alpha; 
+    Game* g = thread->State; 
 
     // 3-fold repetition etc 
     bool draw = IsSpecialDraw(g); 
     if (draw) 
     {
-        return -ctx->ColorContempt * ColorSign(g->Turn); 
+        return -thread->Context->ColorContempt * ColorSign(g->Turn); 
+    }
+
+    // a move that repeats an earlier position guarantees at least a draw 
+    int drawScore = -thread->Context->ColorContempt * ColorSign(g->Turn); 
+    if (alpha < drawScore && HasUpcomingRepetition(g, thread->Ply)) 
+    {
+        alpha = drawScore; 
+        if (alpha >= beta) return alpha; 
     }
 
-    // collect all moves from current position 
-    // these moves must be cleared before returning
-    GenMoves(g, moves); 
-    U64 numMoves = moves->Size - start; 
+    // the repetition draw depends on the path, so a node that does not 
+    // improve on it is stored as a fail low 
+    int alphaOrig = alpha; 
+
+    // moves are only listed when the move picker needs them 
+    MovePicker* picker = &thread->Pickers[thread->Ply]; 
+    if (depth > 0) 
+    {
+        GenMoveInfo(g, &picker->Info); 
+    }
 
     // end of search or end of game 
-    if (depth <= 0 || numMoves == 0 || draw) 
+    if (depth <= 0 || picker->Info.NumMoves == 0 || draw) 
     {
         // no move found for node so this is a leaf node
-        ClearPV(ctx, 0); 
-        ctx->NumLeaves++; 
+        ClearPV(thread, 0); 
+        thread->NumLeaves++; 
 
-        PopMovesToSize(moves, start); 
-        return QSearch(ctx, alpha, beta, 16); 
+        return QSearch(thread, alpha, beta, QSearchDepth); 
     }
 
-    TTableEntry* entry = FindTTableEntry(&ctx->Transpositions, g->Hash, g); 
-    Move hashMove = entry ? entry->Mv : NoMove; 
+    TTableEntry entry; 
+    bool found = FindTTableEntry(&thread->Context->Transpositions, g->Hash, &entry, g); 
+    Move hashMove = found ? entry.Mv : NoMove; 
 
-    if (!ctx->InPV) 
+    if (!thread->InPV) 
     {
-        if (entry && entry->Depth >= depth) 
+        if (found && entry.Depth >= depth) 
         {
-            if (entry->Type == PVNode) 
+            if (entry.Type == PVNode) 
             {
-                PopMovesToSize(moves, start); 
-                return entry->Score; 
+                return entry.Score; 
             }
-            else if (entry->Type == FailHigh) 
+            else if (entry.Type == FailHigh) 
             {
                 // alpha = max(entry, alpha)
-                if (entry->Score > alpha) alpha = entry->Score; 
+                if (entry.Score > alpha) alpha = entry.Score; 
             }
-            else if (entry->Type == FailLow) 
+            else if (entry.Type == FailLow) 
             {
                 // beta = min(entry, beta) 
-                if (entry->Score < beta) beta = entry->Score; 
+                if (entry.Score < beta) beta = entry.Score; 
             }
 
             if (alpha >= beta) 
             {
-                PopMovesToSize(moves, start); 
                 return beta; 
             }
         }
     }
 
-    if (ctx->NullMove) 
+    if (thread->NullMove) 
     {
         static const int R = 2; 
         // don't do null move if: 
@@ -610,34 +860,48 @@ static inline int Negamax_(SearchContext* ctx, int alpha, int beta, int depth)
         // - either side has only pawns 
         if (depth >= 1 + R && !g->InCheck && !EitherSideKP(g)) 
         {
-            ctx->Ply++; 
-            ctx->NullMove = false; 
-            bool pv = ctx->InPV; 
-            ctx->InPV = false; 
+            thread->Ply++; 
+            thread->NullMove = false; 
+            bool pv = thread->InPV; 
+            thread->InPV = false; 
 
             PushNullMove(g); 
             // check if full search would have beta cutoff 
-            int score = -Negamax_(ctx, -beta, -beta + 1, depth - 1 - R); 
+            int score = -Negamax_(thread, -beta, -beta + 1, depth - 1 - R); 
             PopNullMove(g); 
 
+            if (thread->Stopped) 
+            {
+                thread->InPV = pv; 
+                thread->NullMove = true; 
+                thread->Ply--; 
+
+                return 0; 
+            }
+
             if (score >= beta) 
             {
-                ctx->NullMove = true; 
-                ctx->Ply--; 
+                thread->NullMove = true; 
+                thread->Ply--; 
 
-                ClearPV(ctx, 0); 
-                PopMovesToSize(moves, start); 
+                ClearPV(thread, 0); 
                 return beta; 
             }
 
-            ctx->InPV = pv; 
-            ctx->NullMove = true; 
-            ctx->Ply--; 
+            thread->InPV = pv; 
+            thread->NullMove = true; 
+            thread->Ply--; 
         }
     }
 
     NEGAMAX_LOOP_MOVES(); 
 
+    // partial results must not be stored 
+    if (thread->Stopped) 
+    {
+        return 0; 
+    }
+
     int ttType = PVNode; 
     if (alpha <= alphaOrig) 
     {
@@ -648,9 +912,8 @@ static inline int Negamax_(SearchContext* ctx, int alpha, int beta, int depth)
         ttType = FailHigh; 
     }
 
-    UpdateTTable(&ctx->Transpositions, g->Hash, ttType, alpha, depth, bestMove, g); 
+    UpdateTTable(&thread->Context->Transpositions, g->Hash, ttType, alpha, depth, bestMove, g); 
 
-    PopMovesToSize(moves, start); 
 
     return alpha; 
 }
@@ -658,70 +921,71 @@ static inline int Negamax_(SearchContext* ctx, int alpha, int beta, int depth)
 /**
  * Negamax for root nodes. 
  * 
- * @param ctx Search context
+ * @param thread Search thread
  * @param alpha Lower bound
  * @param beta Upper bound 
  * @param depth Remaining depth 
  * @return Evaluation
  */
-static inline int Negamax(SearchContext* ctx, int alpha, int beta, int depth) 
+static inline int Negamax(SearchThread* thread, int alpha, int beta, int depth) 
 {
     // reset data on root node 
-    ctx->NumNodes = 0; 
-    ctx->NumLeaves = 0; 
-    ctx->NumQNodes = 0; 
-    ctx->NumQLeaves = 0; 
-    ctx->CheckTime = 0; 
-    memset(ctx->Killer, 0, sizeof(ctx->Killer)); 
-    memset(ctx->History, 0, sizeof(ctx->History)); 
-    ctx->NullMove = true; 
-    ctx->InPV = true; 
+    thread->NumNodes = 0; 
+    thread->NumLeaves = 0; 
+    thread->NumQNodes = 0; 
+    thread->NumQLeaves = 0; 
+    thread->CheckTime = 0; 
+    memset(thread->Killer, 0, sizeof(thread->Killer)); 
+    memset(thread->History, 0, sizeof(thread->History)); 
+    thread->NullMove = true; 
+    thread->InPV = true; 
 
     // init node 
-    ClearPV(ctx, 0); 
-    ctx->NumNodes++; 
+    ClearPV(thread, 0); 
+    thread->NumNodes++; 
 
     // break out if search should end 
-    HandleOutOfTime(ctx); 
-
-    Game* g = ctx->State; 
-    MoveList* moves = ctx->Moves; 
-    U64 start = moves->Size; 
+    if (ShouldStopSearch(thread)) return 0; 
 
+    Game* g = thread->State; 
     int alphaOrig = alpha; 
 
-    // collect all moves from current position 
-    // these moves must be cleared before returning
-    GenMoves(g, moves); 
-    U64 numMoves = moves->Size - start; 
+    // moves are only listed when the move picker needs them 
+    MovePicker* picker = &thread->Pickers[thread->Ply]; 
+    GenMoveInfo(g, &picker->Info); 
 
     // end of search or end of game 
-    if (depth <= 0 || numMoves == 0) 
+    if (depth <= 0 || picker->Info.NumMoves == 0) 
     {
         // no move found for node so this is a leaf node
-        ClearPV(ctx, 0); 
-        ctx->NumLeaves++; 
+        ClearPV(thread, 0); 
+        thread->NumLeaves++; 
 
-        PopMovesToSize(moves, start); 
-        return QSearch(ctx, alpha, beta, 16); 
+        return QSearch(thread, alpha, beta, QSearchDepth); 
     }
 
-    TTableEntry* entry = FindTTableEntry(&ctx->Transpositions, g->Hash, g); 
-    Move hashMove = entry ? entry->Mv : NoMove; 
+    TTableEntry entry; 
+    bool found = FindTTableEntry(&thread->Context->Transpositions, g->Hash, &entry, g); 
+    Move hashMove = found ? entry.Mv : NoMove; 
 
-    clock_t curTime = clock(); 
-    bool printCurMove = curTime >= ctx->CurMoveAt; 
+    TimePoint curTime = GetTimeMs(); 
+    bool printCurMove = thread->Id == 0 && !thread->Context->Silent && curTime >= thread->Context->CurMoveAt; 
 
     NEGAMAX_LOOP_MOVES(
         if (printCurMove)
         {
             printf("info currmove "); 
             PrintMoveEnd(mv, " currmovenumber "); 
-            printf("%d\n", (int) (i-start+1)); 
+            printf("%d\n", moveNum + 1); 
             fflush(stdout); 
         }
     );
 
+    if (thread->Stopped) 
+    {
+        return 0; 
+    }
+
     int ttType = PVNode; 
     if (alpha <= alphaOrig) 
     {
@@ -731,9 +995,8 @@ static inline int Negamax(SearchContext* ctx, int alpha, int beta, int depth)
     {
         ttType = FailHigh; 
     }
-    UpdateTTable(&ctx->Transpositions, g->Hash, ttType, alpha, depth, bestMove, g); 
+    UpdateTTable(&thread->Context->Transpositions, g->Hash, ttType, alpha, depth, bestMove, g); 
 
-    PopMovesToSize(moves, start); 
     return alpha; 
 }
 
@@ -748,16 +1011,15 @@ static inline int Negamax(SearchContext* ctx, int alpha, int beta, int depth)
  * @param eval Negamax evaluation
  * @param line Best PV for current search
  */
-static inline void UpdateSearch(SearchContext* ctx, clock_t searchStart, clock_t start, clock_t end, int depth, int eval, const PVLine* line) 
+static inline void UpdateSearch(SearchContext* ctx, TimePoint searchStart, TimePoint start, TimePoint end, int depth, int eval, const PVLine* line) 
 {
     (void) start; 
 
-    U64 nodes = ctx->State->Nodes;
+    U64 nodes = GetSearchNodes(ctx);
 
     float startDuration = (end - searchStart); 
     if (startDuration <= 0) startDuration = 1; 
-    float nps = nodes / (startDuration / CLOCKS_PER_SEC); 
-    startDuration /= CLOCKS_PER_SEC * 0.001; 
+    float nps = nodes / (startDuration / 1000); 
 
     ctx->BestLine = *line; 
     ctx->Nodes = nodes; 
@@ -765,29 +1027,31 @@ static inline void UpdateSearch(SearchContext* ctx, clock_t searchStart, clock_t
     ctx->Depth = depth; 
     ctx->Eval = eval; 
 
+    if (ctx->Silent) return; 
+
     if (IsMateScore(eval)) 
     {
         int matePly = 100000 - abs(eval); 
         int plies = matePly;
-        printf("info depth %d seldepth %" PRIu64 " multipv 1 score mate %d time %.0f nodes %" PRIu64 " nps %.0f hashfull %.0f pv ", 
+        printf("info depth %d seldepth %" PRIu64 " multipv 1 score mate %d time %.0f nodes %" PRIu64 " nps %.0f hashfull %d pv ", 
             depth, 
             ctx->BestLine.NumMoves, 
             (eval > 0 ? 1 : -1) * (plies/2), 
             startDuration, 
             nodes, 
             nps, 
-            1000.0f * ctx->Transpositions.Used / ctx->Transpositions.Size); 
+            GetTTableHashfull(&ctx->Transpositions)); 
     }
     else 
     {
-        printf("info depth %d seldepth %" PRIu64 " multipv 1 score cp %d time %.0f nodes %" PRIu64 " nps %.0f hashfull %.0f pv ", 
+        printf("info depth %d seldepth %" PRIu64 " multipv 1 score cp %d time %.0f nodes %" PRIu64 " nps %.0f hashfull %d pv ", 
             depth, 
             ctx->BestLine.NumMoves, 
             eval, 
             startDuration, 
             nodes, 
             nps, 
-            1000.0f * ctx->Transpositions.Used / ctx->Transpositions.Size); 
+            GetTTableHashfull(&ctx->Transpositions)); 
     }
     // print PV for mate and normal eval 
     for (U64 i = 0; i < ctx->BestLine.NumMoves; i++) 
@@ -798,29 +1062,60 @@ static inline void UpdateSearch(SearchContext* ctx, clock_t searchStart, clock_t
     fflush(stdout); 
 }
 
+/**
+ * Stores the result of a completed iteration. 
+ * The main thread also reports it to stdout. 
+ * 
+ * @param thread Search thread 
+ * @param searchStart Start time of search
+ * @param start Start of current depth's search
+ * @param end When did current depth's search end 
+ * @param depth Current search depth target 
+ * @param eval Negamax evaluation
+ */
+static inline void CompleteIteration(SearchThread* thread, TimePoint searchStart, TimePoint start, TimePoint end, int depth, int eval) 
+{
+    thread->BestLine = thread->Lines[0]; 
+    thread->Depth = depth; 
+    thread->Eval = eval; 
+
+    if (thread->Id == 0) 
+    {
+        UpdateSearch(thread->Context, searchStart, start, end, depth, eval, &thread->Lines[0]); 
+    }
+}
+
 /**
  * Performs the search using iterative deepening and aspiration windows. 
  * 
- * @param ctx Search context 
+ * Helper threads with odd IDs search one ply deeper than the main thread 
+ * so that threads are less likely to search identical trees. 
+ * 
+ * @param thread Search thread 
  */
-void RunSearch(SearchContext* ctx) 
+void RunSearch(SearchThread* thread) 
 {
-    clock_t start, end, searchStart = clock(); 
+    SearchContext* ctx = thread->Context; 
+    TimePoint start, end, searchStart = ctx->StartAt; 
 
     int tgtDepth = ctx->TargetDepth; 
     if (tgtDepth < 0) tgtDepth = INT_MAX; 
     if (tgtDepth > MaxDepth) tgtDepth = MaxDepth; 
 
+    int skip = thread->Id & 1; 
+
     // there is no last eval for depth 1
-    start = clock(); 
-    int eval = Negamax(ctx, -MaxScore, MaxScore, 1); 
-    end = clock(); 
-    UpdateSearch(ctx, searchStart, start, end, 1, eval, &ctx->Lines[0]); 
+    start = GetTimeMs(); 
+    int eval = Negamax(thread, -MaxScore, MaxScore, 1); 
+    end = GetTimeMs(); 
+    if (!thread->Stopped) 
+    {
+        CompleteIteration(thread, searchStart, start, end, 1, eval); 
+    }
 
     // iterative deepening
-    for (int depth = 2; depth <= tgtDepth; depth++) 
+    for (int depth = 2 + skip; depth <= tgtDepth && !thread->Stopped; depth++) 
     {
-        ClearMoves(ctx->Moves); 
         int last = eval; 
 
         // aspiration windows 
@@ -829,12 +1124,16 @@ void RunSearch(SearchContext* ctx)
         int ai = 0; 
         int bi = 0; 
 
-        start = clock(); 
+        start = GetTimeMs(); 
         while (true) 
         {
-            eval = Negamax(ctx, a[ai], b[bi], depth); 
+            eval = Negamax(thread, a[ai], b[bi], depth); 
 
-            if (eval <= a[ai]) 
+            if (thread->Stopped) 
+            {
+                break; 
+            }
+            else if (eval <= a[ai]) 
             {
                 ai++; 
             }
@@ -847,76 +1146,230 @@ void RunSearch(SearchContext* ctx)
                 break; 
             }
         }
-        end = clock(); 
+        end = GetTimeMs(); 
+
+        // results of an unfinished iteration are discarded 
+        if (thread->Stopped) break; 
         
-        UpdateSearch(ctx, searchStart, start, end, depth, eval, &ctx->Lines[0]); 
+        CompleteIteration(thread, searchStart, start, end, depth, eval); 
+
+        // only the main thread decides when the search is over 
+        if (thread->Id == 0 && ShouldStopIteration(&ctx->Time, thread->BestLine.Moves[0], eval)) 
+        {
+            break; 
+        }
     }
 
-    ctx->Running = false; 
+    // helpers finishing early just go idle 
+    if (thread->Id != 0) return; 
 
-    printf("bestmove "); 
-    PrintMoveEnd(ctx->Lines[0].Moves[0], "\n"); 
-    fflush(stdout); 
+    StopHelperThreads(ctx); 
+    PrintBestMove(ctx); 
 }
 
 /**
- * Entry point for search thread. 
+ * Entry point for search threads. 
  * 
- * @param data Pointer to the search context 
+ * Workers live as long as the context (or until the number of threads 
+ * changes). Between searches they sleep until `Search` wakes them up. 
+ * 
+ * @param data Pointer to the search thread 
  * @return Null
  */
-static void* StartPThreadSearch(void* data) 
+static void* SearchWorker(void* data) 
 {
-    SearchContext* ctx = data; 
-    RunSearch(ctx); 
+    SearchThread* thread = data; 
+    SearchContext* ctx = thread->Context; 
+
+    pthread_mutex_lock(&ctx->Lock); 
+    while (true) 
+    {
+        while (!thread->Searching && !ctx->Quit) 
+        {
+            pthread_cond_wait(&ctx->WakeCond, &ctx->Lock); 
+        }
+        if (ctx->Quit) break; 
+
+        pthread_mutex_unlock(&ctx->Lock); 
+        RunSearch(thread); 
+        pthread_mutex_lock(&ctx->Lock); 
+
+        thread->Searching = false; 
+        if (thread->Id == 0) ctx->Running = false; 
+        pthread_cond_broadcast(&ctx->DoneCond); 
+    }
+    pthread_mutex_unlock(&ctx->Lock); 
 
     return NULL; 
 }
 
+/**
+ * Allocates per-thread search data. 
+ * 
+ * @param ctx Search context 
+ * @param thread The thread 
+ * @param id Thread index 
+ */
+static void CreateSearchThread(SearchContext* ctx, SearchThread* thread, int id) 
+{
+    memset(thread, 0, sizeof(SearchThread)); 
+
+    thread->Context = ctx; 
+    thread->Id = id; 
+    thread->State = NewGame(); 
+    CreatePawnTable(&thread->Pawns); 
+    CreateMaterialTable(&thread->Materials); 
+    CreateEvalCache(&thread->Evals); 
+
+    pthread_create(&thread->Thread, NULL, SearchWorker, thread); 
+}
+
+/**
+ * Deallocates per-thread search data. 
+ * The worker must already have been told to quit. 
+ * 
+ * @param thread The thread 
+ */
+static void DestroySearchThread(SearchThread* thread) 
+{
+    pthread_join(thread->Thread, NULL); 
+
+    FreeGame(thread->State); 
+    DestroyPawnTable(&thread->Pawns); 
+    DestroyMaterialTable(&thread->Materials); 
+    DestroyEvalCache(&thread->Evals); 
+}
+
+/**
+ * Resets per-thread data before a new search. 
+ * 
+ * @param ctx Search context 
+ * @param thread The thread 
+ */
+static void PrepareSearchThread(SearchContext* ctx, SearchThread* thread) 
+{
+    thread->BestLine.NumMoves = 0; 
+    thread->Depth = 0; 
+    thread->Eval = 0; 
+    thread->CheckTime = 0; 
+    thread->Stopped = false; 
+
+    // cached entries stay valid between searches, only statistics are reset 
+    thread->Pawns.Probes = 0; 
+    thread->Pawns.Hits = 0; 
+    thread->Evals.Probes = 0; 
+    thread->Evals.Hits = 0; 
+
+    thread->Ply = 0; 
+    for (int i = 0; i < MaxDepth; i++) 
+    {
+        thread->Lines[i].NumMoves = 0; 
+    }
+
+    // every thread searches its own copy of the board 
+    CopyGame(thread->State, ctx->State); 
+
+    // only threads that evaluate with the network keep accumulators 
+    if (!UseNnue) ReleaseAccumulator(thread->State); 
+    else if (!thread->State->Acc) RefreshAccumulator(thread->State); 
+}
+
 void CreateSearchContext(SearchContext* ctx) 
 {
     memset(ctx, 0, sizeof(SearchContext)); 
 
     // board should always be initialized
     ctx->State = NewGame(); 
-    ctx->Moves = NewMoveList(); 
     ctx->Contempt = 0; 
     CreateTTable(&ctx->Transpositions, 1); 
 
     pthread_mutex_init(&ctx->Lock, NULL); 
+    pthread_cond_init(&ctx->WakeCond, NULL); 
+    pthread_cond_init(&ctx->DoneCond, NULL); 
+
+    ctx->NumThreads = 1; 
+    ctx->Threads = malloc(sizeof(SearchThread)); 
+    CreateSearchThread(ctx, &ctx->Threads[0], 0); 
+} 
+
+/**
+ * Wakes up all workers and waits for them to exit. 
+ * 
+ * @param ctx Search context 
+ */
+static void DestroySearchThreads(SearchContext* ctx) 
+{
+    pthread_mutex_lock(&ctx->Lock); 
+    ctx->Quit = true; 
+    pthread_cond_broadcast(&ctx->WakeCond); 
+    pthread_mutex_unlock(&ctx->Lock); 
+
+    for (int i = 0; i < ctx->NumThreads; i++) 
+    {
+        DestroySearchThread(&ctx->Threads[i]); 
+    }
+    free(ctx->Threads); 
+
+    ctx->Quit = false; 
 } 
 
 void DestroySearchContext(SearchContext* ctx) 
 {
     StopSearchContext(ctx); 
+    DestroySearchThreads(ctx); 
     FreeGame(ctx->State); 
-    FreeMoveList(ctx->Moves); 
     DestroyTTable(&ctx->Transpositions); 
+    pthread_cond_destroy(&ctx->WakeCond); 
+    pthread_cond_destroy(&ctx->DoneCond); 
     pthread_mutex_destroy(&ctx->Lock); 
 }
 
-void StopSearchContext(SearchContext* ctx) 
+void SetSearchThreads(SearchContext* ctx, int numThreads) 
 {
-    if (ctx->Running) 
+    if (numThreads < 1) numThreads = 1; 
+    if (numThreads > MaxSearchThreads) numThreads = MaxSearchThreads; 
+
+    StopSearchContext(ctx); 
+    DestroySearchThreads(ctx); 
+
+    ctx->NumThreads = numThreads; 
+    ctx->Threads = malloc(numThreads * sizeof(SearchThread)); 
+    for (int i = 0; i < numThreads; i++) 
     {
-        ctx->ShouldExit = true; 
-        pthread_join(ctx->Thread, NULL); 
+        CreateSearchThread(ctx, &ctx->Threads[i], i); 
+    }
+}
 
-        ClearMoves(ctx->Moves); 
-        // ResetTTable(&ctx->TT); 
-        ctx->Running = false; 
+void ClearSearchEvals(SearchContext* ctx) 
+{
+    StopSearchContext(ctx); 
+
+    for (int i = 0; i < ctx->NumThreads; i++) 
+    {
+        ClearEvalCache(&ctx->Threads[i].Evals); 
+        ClearPawnTable(&ctx->Threads[i].Pawns); 
+        ClearMaterialTable(&ctx->Threads[i].Materials); 
     }
+}
+
+void StopSearchContext(SearchContext* ctx) 
+{
+    atomic_store_explicit(&ctx->ShouldExit, true, memory_order_relaxed); 
+    WaitForSearchContext(ctx); 
 
-    ctx->ShouldExit = false; 
+    atomic_store_explicit(&ctx->ShouldExit, false, memory_order_relaxed); 
     fflush(stdout); 
 }
 
 void WaitForSearchContext(SearchContext* ctx) 
 {
-    if (ctx->Running) 
+    // the main thread only finishes after all helpers have gone idle 
+    pthread_mutex_lock(&ctx->Lock); 
+    while (ctx->Running) 
     {
-        pthread_join(ctx->Thread, NULL); 
+        pthread_cond_wait(&ctx->DoneCond, &ctx->Lock); 
     }
+    pthread_mutex_unlock(&ctx->Lock); 
 }
 
 void Search(SearchContext* ctx, SearchParams* params) 
@@ -930,24 +1383,19 @@ void Search(SearchContext* ctx, SearchParams* params)
     ctx->Nps = 0; 
     ctx->Depth = 0; 
     ctx->Eval = 0; 
-    ctx->Running = true; 
-    ctx->StartAt = clock(); 
+    ctx->StartAt = GetTimeMs(); 
     ctx->CurMoveAt = NSecondsFromNow(2); 
     ctx->NextMessageAt = NSecondsFromNow(1); 
 
-    ClearMoves(ctx->Moves); 
-    ctx->Ply = 0; 
-    for (int i = 0; i < MaxDepth; i++) 
+    ctx->TargetDepth = params->Depth; 
+    atomic_store_explicit(&ctx->ShouldExit, false, memory_order_relaxed); 
+    if (params->TimeMs < 0 && params->ClockMs >= 0) 
     {
-        ctx->Lines[i].NumMoves = 0; 
+        InitClockTime(&ctx->Time, params->ClockMs, params->IncMs, params->MovesToGo); 
     }
-
-    ctx->TargetDepth = params->Depth; 
-    ctx->TargetTimeMs = params->TimeMs; 
-    ctx->ShouldExit = false; 
-    if (ctx->TargetTimeMs >= 0) 
+    else 
     {
-        ctx->EndAt = clock() + ctx->TargetTimeMs * CLOCKS_PER_SEC / 1000; 
+        InitFixedTime(&ctx->Time, params->TimeMs); 
     }
 
     // assign the current board state to the search context 
@@ -955,15 +1403,30 @@ void Search(SearchContext* ctx, SearchParams* params)
     ClearDepth(ctx->State); 
 
     ctx->StartColor = ctx->State->Turn; 
+    NewTTableSearch(&ctx->Transpositions); 
     ctx->ColorContempt = ColorSign(ctx->StartColor) * ctx->Contempt; 
 
-    // run search on another thread 
-    pthread_create(&ctx->Thread, NULL, StartPThreadSearch, ctx); 
+    for (int i = 0; i < ctx->NumThreads; i++) 
+    {
+        PrepareSearchThread(ctx, &ctx->Threads[i]); 
+    }
+
+    // wake up the workers, helpers are stopped by the main thread when it finishes 
+    pthread_mutex_lock(&ctx->Lock); 
+    ctx->Running = true; 
+    for (int i = 0; i < ctx->NumThreads; i++) 
+    {
+        ctx->Threads[i].Searching = true; 
+    }
+    pthread_cond_broadcast(&ctx->WakeCond); 
+    pthread_mutex_unlock(&ctx->Lock); 
 }
 
 int BasicQSearch(SearchContext* ctx) 
 {
-    ctx->BestLine.NumMoves = 0; 
+    SearchThread* thread = &ctx->Threads[0]; 
+
+    PrepareSearchThread(ctx, thread); 
     NoHandleTime = true; 
-    return QSearch(ctx, -MaxScore, MaxScore, 16); 
-} 
+    return QSearch(thread, -MaxScore, MaxScore, QSearchDepth); 
+}
@@ -15,11 +15,14 @@
 
 #include <pthread.h> 
 
+#include "EvalCache.h" 
 #include "Game.h" 
+#include "Material.h" 
 #include "MoveGen.h"
 #include "Piece.h"
 #include "Square.h"
 #include "TTable.h" 
+#include "TimeMan.h" 
 
 #define InfDepth (-1) 
 #define InfTime (-1) 
@@ -27,6 +30,23 @@
 typedef struct PVLine PVLine; 
 typedef struct SearchContext SearchContext; 
 typedef struct SearchParams SearchParams; 
+typedef struct SearchThread SearchThread; 
+typedef struct MovePicker MovePicker; 
+
+/**
+ * Maximum number of threads that can search at the same time. 
+ */
+#define MaxSearchThreads 256 
+
+/**
+ * Depth of the quiescence search at the leaves of the main search. 
+ */
+#define QSearchDepth 16 
+
+/**
+ * Maximum distance from the root, including quiescence search. 
+ */
+#define MaxPly (MaxDepth + QSearchDepth + 1) 
 
 /**
  * Principal variation. 
@@ -38,45 +58,115 @@ struct PVLine
 };
 
 /**
- * Data used by search. 
+ * Stages of the move picker, in the order they are searched. 
  */
-struct SearchContext 
+typedef enum 
 {
-    Game* State; 
-    int StartPly; 
+    PickPV, 
+    PickHash, 
+    PickGenTactical, 
+    PickTactical, 
+    PickKiller1, 
+    PickKiller2, 
+    PickGenQuiet, 
+    PickQuiet, 
+    PickBadTactical, 
+    PickDone 
+} PickStage;
+
+/**
+ * Returns moves of a node in stages: previous PV move, TT move, 
+ * winning captures and promotions, killer moves, quiet moves and finally 
+ * captures that lose material. Each ply has its own picker, and the moves 
+ * of its node are listed in the picker. 
+ */
+struct MovePicker 
+{
+    PickStage Stage; 
+    MoveInfo Info; 
+    Move PVMove; 
+    Move HashMove; 
+    Move Tried[4]; 
+    int NumTried; 
+    U64 Next; 
+    U64 BadStart; 
+    U64 BadEnd; 
+    MoveList Moves; 
+};
+
+/**
+ * Data owned by a single search thread. 
+ * 
+ * Thread 0 is the main thread: it manages time and reports search info. 
+ * All other threads are helpers that search the same position to fill 
+ * the shared transposition table (lazy SMP). 
+ */
+struct SearchThread 
+{
+    SearchContext* Context; 
+    int Id; 
     pthread_t Thread; 
-    int TargetDepth; 
-    int TargetTimeMs; 
-    clock_t EndAt; 
-    bool ShouldExit; 
+    bool Searching; 
 
-    pthread_mutex_t Lock; 
+    Game* State; 
+    PawnTable Pawns; 
+    MaterialTable Materials; 
+    EvalCache Evals; 
+    PVLine Lines[MaxDepth]; 
     PVLine BestLine; 
-    U64 Nodes; 
-    U64 Nps; 
     int Depth; 
     int Eval; 
-    bool Running; 
-    clock_t StartAt; 
-    clock_t CurMoveAt; 
-    clock_t NextMessageAt; 
 
-    MoveList* Moves; 
-    PVLine Lines[MaxDepth]; 
-    TTable Transpositions; 
     U64 NumNodes; 
     U64 NumLeaves; 
     U64 NumQNodes; 
     U64 NumQLeaves; 
     int CheckTime; 
+    bool Stopped; 
     int Ply; 
     Move Killer[MaxDepth][2]; 
+    MovePicker Pickers[MaxPly]; 
     int History[2][NumPieces][NumSquares]; 
     bool NullMove; 
     bool InPV; 
+};
+
+/**
+ * Data used by search. 
+ */
+struct SearchContext 
+{
+    Game* State; 
+    int StartPly; 
+    int TargetDepth; 
+    TimeManager Time; 
+    atomic_bool ShouldExit; 
+
+    pthread_mutex_t Lock; 
+    pthread_cond_t WakeCond; 
+    pthread_cond_t DoneCond; 
+    bool Quit; 
+    PVLine BestLine; 
+    U64 Nodes; 
+    U64 Nps; 
+    U64 PawnProbes; 
+    U64 PawnHits; 
+    U64 EvalProbes; 
+    U64 EvalHits; 
+    int Depth; 
+    int Eval; 
+    bool Running; 
+    TimePoint StartAt; 
+    TimePoint CurMoveAt; 
+    TimePoint NextMessageAt; 
+
+    SearchThread* Threads; 
+    int NumThreads; 
+    TTable Transpositions; 
     int Contempt; 
     int ColorContempt; 
     Color StartColor; 
+    bool Silent; // don't print search info or the best move 
 };
 
 /**
@@ -87,6 +177,9 @@ struct SearchParams
     const Game* Board; 
     int Depth; 
     int TimeMs; 
+    int ClockMs; 
+    int IncMs; 
+    int MovesToGo; 
 };
 
 /**
@@ -159,8 +252,46 @@ static void InitSearchParams(SearchParams* sp, const Game* board, int depth, int
     sp->Board = board; 
     sp->Depth = depth; 
     sp->TimeMs = timeMs; 
+    sp->ClockMs = InfTime; 
+    sp->IncMs = 0; 
+    sp->MovesToGo = 0; 
 }
 
+/**
+ * Sets the game clock used to budget search time. 
+ * Ignored if the settings have a fixed target time. 
+ * 
+ * @param sp The settings 
+ * @param clockMs Time left on the clock 
+ * @param incMs Increment per move 
+ * @param movesToGo Moves until the next time control (or 0 if unknown) 
+ */
+static void SetSearchParamsClock(SearchParams* sp, int clockMs, int incMs, int movesToGo) 
+{
+    sp->ClockMs = clockMs; 
+    sp->IncMs = incMs; 
+    sp->MovesToGo = movesToGo; 
+}
+
+/**
+ * Sets the number of threads used for search. 
+ * Stops the current search if one is running. 
+ * 
+ * @param ctx The context 
+ * @param numThreads Number of threads (clamped to 1..MaxSearchThreads)
+ */
+void SetSearchThreads(SearchContext* ctx, int numThreads); 
+
+/**
+ * Removes cached evaluations, pawn structure and material entries of all 
+ * search threads. This must be called when the evaluation function or its 
+ * weights change. 
+ * Stops the current search if one is running. 
+ * 
+ * @param ctx The context 
+ */
+void ClearSearchEvals(SearchContext* ctx); 
+
 /**
  * Starts searching the specified board position on a new thread. 
  * If the context was already searching then the old search stops. 
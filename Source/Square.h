@@ -163,6 +163,22 @@ static inline int GetAnti(Square sq)
     return Anti[sq]; 
 }
 
+/**
+ * Get the number of king moves between two squares. 
+ * 
+ * @param a First square 
+ * @param b Second square 
+ * @return The distance 
+ */
+static inline int GetDistance(Square a, Square b) 
+{
+    int df = (a & 7) - (b & 7); 
+    int dr = (a >> 3) - (b >> 3); 
+    if (df < 0) df = -df; 
+    if (dr < 0) dr = -dr; 
+    return df > dr ? df : dr; 
+}
+
 /**
  * Reverse the rank of a square.
  * 
@@ -39,7 +39,7 @@ void LoadFens(const char* filename, const char* outfile)
         MoveInfo info; 
         GenMoveInfo(ctx->State, &info); 
 
-        if (Evaluate(ctx->State, 0, info.NumMoves, false, 0) == ColorSign(ctx->State->Turn) * BasicQSearch(ctx)) 
+        if (Evaluate(ctx->State, NULL, NULL, 0, info.NumMoves, false, 0) == ColorSign(ctx->State->Turn) * BasicQSearch(ctx)) 
         {
             fprintf(outFile, "%s\n", buf); 
             quiet++; 
@@ -67,5 +67,7 @@ int main(int argc, char** argv)
         return 1; 
     }
 
+    InitSliderTables(); 
+
     LoadFens(argv[1], argv[2]); 
 }
@@ -9,103 +9,254 @@
  */
 #include "TTable.h" 
 
+#include <stdint.h> 
 #include <stdlib.h> 
 
+/**
+ * Size of a cache line in bytes. 
+ */
+#define CacheLineSize 64 
+
+/**
+ * Packs entry fields into a single value. 
+ * 
+ * @param mv Best move 
+ * @param type Node type 
+ * @param depth Search depth 
+ * @param age Search generation 
+ * @param score Evaluation score 
+ * @return Packed data 
+ */
+static inline U64 PackTTableData(Move mv, int type, int depth, int age, int score) 
+{
+    if (depth < 0) depth = 0; 
+    if (depth > 255) depth = 255; 
+
+    // clamping only weakens bounds: fail high/low scores past the limit stay correct 
+    if (score > TTableMaxScore) score = TTableMaxScore; 
+    if (score < -TTableMaxScore) score = -TTableMaxScore; 
+
+    return ((U64) (mv & 0x3FFFFFFF)) 
+         | ((U64) type << 30) 
+         | ((U64) depth << 33) 
+         | ((U64) age << 41) 
+         | ((U64) (score + TTableMaxScore + 1) << 46); 
+} 
+
+/**
+ * @param data Packed data 
+ * @return Node type 
+ */
+static inline int TTableDataType(U64 data) 
+{
+    return (int) ((data >> 30) & 7); 
+} 
+
+/**
+ * @param data Packed data 
+ * @return Search depth 
+ */
+static inline int TTableDataDepth(U64 data) 
+{
+    return (int) ((data >> 33) & 255); 
+} 
+
+/**
+ * @param data Packed data 
+ * @return Search generation 
+ */
+static inline int TTableDataAge(U64 data) 
+{
+    return (int) ((data >> 41) & (TTableNumAges - 1)); 
+} 
+
+/**
+ * Unpacks entry fields. 
+ * 
+ * @param data Packed data 
+ * @param entry Output entry 
+ */
+static inline void UnpackTTableData(U64 data, TTableEntry* entry) 
+{
+    entry->Mv = (Move) (data & 0x3FFFFFFF); 
+    entry->Type = TTableDataType(data); 
+    entry->Depth = TTableDataDepth(data); 
+    entry->Score = (int) (data >> 46) - TTableMaxScore - 1; 
+} 
+
+/**
+ * Number of generations since an entry was written. 
+ * 
+ * @param tt The table 
+ * @param data Packed data 
+ * @return Relative age 
+ */
+static inline int TTableRelativeAge(const TTable* tt, U64 data) 
+{
+    return (tt->Age - TTableDataAge(data)) & (TTableNumAges - 1); 
+} 
+
 void CreateTTable(TTable* tt, U64 sizeInMB) 
 {
-    U64 entriesInSize = (sizeInMB * 1024 * 1024) / sizeof(TTableEntry); 
+    U64 bucketBytes = sizeof(TTableBucket); 
+#ifdef VALIDATION
+    // stored states count towards the size so validation builds stay in budget 
+    bucketBytes += TTableBucketSize * sizeof(Game); 
+#endif
+    U64 bucketsInSize = (sizeInMB * 1024 * 1024) / bucketBytes; 
     // get highest power of two 
-    entriesInSize = 1ULL << MostSigBit(entriesInSize); 
-    tt->Size = entriesInSize; 
+    bucketsInSize = 1ULL << MostSigBit(bucketsInSize); 
+    tt->Size = bucketsInSize; 
     tt->Mask = tt->Size - 1; 
-    tt->Entries = malloc(tt->Size * sizeof(TTableEntry)); 
+
+    // align buckets to cache lines so one probe touches one line 
+    tt->Memory = malloc(tt->Size * sizeof(TTableBucket) + CacheLineSize); 
+    tt->Buckets = (TTableBucket*) (((uintptr_t) tt->Memory + CacheLineSize - 1) & ~((uintptr_t) CacheLineSize - 1)); 
+#ifdef VALIDATION
+    // zeroed so the stored games have no accumulators 
+    tt->States = calloc(tt->Size * TTableBucketSize, sizeof(Game)); 
+#endif
+
+    ResetTTable(tt); 
 } 
 
 void DestroyTTable(TTable* tt) 
 {
-    free(tt->Entries); 
+    free(tt->Memory); 
+#ifdef VALIDATION
+    free(tt->States); 
+#endif
 } 
 
 void ResetTTable(TTable* tt) 
 {
-    tt->Searches = 0; 
-    tt->Hits = 0; 
-    tt->Collisions = 0; 
-    tt->Used = 0; 
-    for (U64 i = 0; i < tt->Size; i++) 
-    {
-        tt->Entries[i].Type = NoNode; 
-    }
+    tt->Age = 0; 
+    memset(tt->Buckets, 0, tt->Size * sizeof(TTableBucket)); 
 } 
 
-TTableEntry* FindTTableEntry(TTable* tt, Zobrist key, const Game* state) 
+void NewTTableSearch(TTable* tt) 
 {
-    TTableEntry* entry = &tt->Entries[key & tt->Mask]; 
+    tt->Age = (tt->Age + 1) & (TTableNumAges - 1); 
+} 
 
-    tt->Searches++; 
+bool FindTTableEntry(TTable* tt, Zobrist key, TTableEntry* entry, const Game* state) 
+{
+    TTableBucket* bucket = &tt->Buckets[key & tt->Mask]; 
 
-    // fail if: 
-    // - no position is stored 
-    // - positions are not equal 
-    // - requested depth is deeper than stored depth 
-    if (entry->Type == NoNode || entry->Key != key)// || entry->Depth < depth) 
+    for (int i = 0; i < TTableBucketSize; i++) 
     {
-        return NULL; 
-    }
+        U64 data = atomic_load_explicit(&bucket->Slots[i].Data, memory_order_relaxed); 
+        U64 check = atomic_load_explicit(&bucket->Slots[i].Key, memory_order_relaxed); 
+
+        // fail if: 
+        // - no position is stored 
+        // - positions are not equal (or the slot is mid-write by another thread) 
+        if (TTableDataType(data) == NoNode || (check ^ data) != key) 
+        {
+            continue; 
+        }
 #ifdef VALIDATION
-    if (!EqualsTTableGame(&entry->State, state)) 
-    {
-        printf("info string query hash is equal but position is not:\n"); 
-        // PrintMailbox(&entry->Board); 
-        PrintGame(&entry->State); 
-        printf("vs\n"); 
-        // PrintMailbox(mbox); 
-        PrintGame(state); 
-        exit(1); 
-    }
+        const Game* stored = &tt->States[(key & tt->Mask) * TTableBucketSize + i]; 
+        if (!EqualsTTableGame(stored, state)) 
+        {
+            printf("info string query hash is equal but position is not:\n"); 
+            PrintGame(stored); 
+            printf("vs\n"); 
+            PrintGame(state); 
+            exit(1); 
+        }
 #else
-    (void) state; 
+        (void) state; 
 #endif
 
-    tt->Hits++; 
-    return entry; 
+        UnpackTTableData(data, entry); 
+        return true; 
+    }
+
+    return false; 
 } 
 
 void UpdateTTable(TTable* tt, Zobrist key, int type, int score, int depth, Move mv, const Game* state) 
 {
-    TTableEntry* entry = &tt->Entries[key & tt->Mask]; 
+    TTableBucket* bucket = &tt->Buckets[key & tt->Mask]; 
 
-    if (entry->Type == NoNode) 
+    // choose which slot to replace: 
+    // - same position is always replaced 
+    // - otherwise empty slots, then entries from old searches, then shallow entries 
+    int replace = 0; 
+    int worst = INT_MAX; 
+    for (int i = 0; i < TTableBucketSize; i++) 
     {
-        tt->Used++; 
-    }
-    // node exists, is it a different state? 
-    else if (entry->Key != key) 
-    {
-        tt->Collisions++; 
+        U64 data = atomic_load_explicit(&bucket->Slots[i].Data, memory_order_relaxed); 
+        U64 check = atomic_load_explicit(&bucket->Slots[i].Key, memory_order_relaxed); 
+
+        if (TTableDataType(data) == NoNode) 
+        {
+            replace = i; 
+            break; 
+        }
+
+        if ((check ^ data) == key) 
+        {
+            // keep the previous best move if the new search has none 
+            if (mv == NoMove) mv = (Move) (data & 0x3FFFFFFF); 
+
+            // don't let shallow bounds from this search overwrite a deeper result 
+            if (type != PVNode && TTableRelativeAge(tt, data) == 0 && depth + 3 < TTableDataDepth(data)) 
+            {
+                return; 
+            }
+
+            replace = i; 
+            break; 
+        }
+
+        int value = TTableDataDepth(data) - 8 * TTableRelativeAge(tt, data); 
+        if (value < worst) 
+        {
+            worst = value; 
+            replace = i; 
+        }
     }
-    // key is equal, is there a key collision? 
+
 #ifdef VALIDATION
-    else if (!EqualsTTableGame(&entry->State, state)) 
+    Game* stored = &tt->States[(key & tt->Mask) * TTableBucketSize + replace]; 
+    U64 oldData = atomic_load_explicit(&bucket->Slots[replace].Data, memory_order_relaxed); 
+    U64 oldCheck = atomic_load_explicit(&bucket->Slots[replace].Key, memory_order_relaxed); 
+    // key is equal, is there a key collision? 
+    if (TTableDataType(oldData) != NoNode && (oldCheck ^ oldData) == key && !EqualsTTableGame(stored, state)) 
     {
         printf("info string hash is equal but position is not:\n"); 
-        // PrintMailbox(&entry->Board); 
-        PrintGame(&entry->State); 
+        PrintGame(stored); 
         printf("vs\n"); 
-        // PrintMailbox(mbox); 
         PrintGame(state); 
         exit(1); 
     }
+    CopyGame(stored, state); 
 #else
     (void) state; 
 #endif
 
-    entry->Key = key; 
-    entry->Type = type; 
-    entry->Score = score; 
-    entry->Depth = depth; 
-    entry->Mv = mv; 
-#ifdef VALIDATION
-    CopyGame(&entry->State, state); 
-#endif
+    U64 data = PackTTableData(mv, type, depth, tt->Age, score); 
+    atomic_store_explicit(&bucket->Slots[replace].Key, key ^ data, memory_order_relaxed); 
+    atomic_store_explicit(&bucket->Slots[replace].Data, data, memory_order_relaxed); 
+} 
+
+int GetTTableHashfull(const TTable* tt) 
+{
+    // sample the first buckets, which is enough for an estimate 
+    U64 numBuckets = 1000 / TTableBucketSize; 
+    if (numBuckets > tt->Size) numBuckets = tt->Size; 
+
+    int used = 0; 
+    for (U64 b = 0; b < numBuckets; b++) 
+    {
+        for (int i = 0; i < TTableBucketSize; i++) 
+        {
+            U64 data = atomic_load_explicit(&tt->Buckets[b].Slots[i].Data, memory_order_relaxed); 
+            used += TTableDataType(data) != NoNode && TTableRelativeAge(tt, data) == 0; 
+        }
+    }
+
+    return (int) (1000 * used / (numBuckets * TTableBucketSize)); 
 } 
@@ -6,10 +6,17 @@
  * Copyright (c) 2023 Nicholas Hamilton
  * 
  * Defines transposition table. 
+ * 
+ * The table is split into buckets the size of a cache line. Each bucket 
+ * holds several packed entries. Entries are written without locks: the 
+ * stored key is XORed with the entry data, so a torn write from another 
+ * thread fails key verification instead of returning corrupted data. 
  */
 
 #pragma once 
 
+#include <stdatomic.h> 
+
 #include "Game.h" 
 #include "Mailbox.h"
 #include "Move.h" 
@@ -28,37 +35,78 @@ typedef enum
     FailLow
 } NodeType;
 
+/**
+ * Number of entries in one bucket. 
+ */
+#define TTableBucketSize 4 
+
+/**
+ * Number of search generations before the age wraps around. 
+ */
+#define TTableNumAges 32 
+
+/**
+ * Largest score magnitude that can be stored. Larger bounds are clamped. 
+ */
+#define TTableMaxScore 131071 
+
 /**
  * Transposition table. 
  */
 typedef struct TTable TTable; 
 
 /**
- * Transposition table entry data. 
+ * Decoded transposition table entry data. 
  */
 typedef struct TTableEntry TTableEntry; 
 
-struct TTable 
+/**
+ * Packed entry as it is stored in the table. 
+ */
+typedef struct TTableSlot TTableSlot; 
+
+/**
+ * Group of slots that share a cache line. 
+ */
+typedef struct TTableBucket TTableBucket; 
+
+struct TTableEntry 
 {
-    TTableEntry* Entries; 
-    U64 Size; 
-    U64 Mask; 
-    U64 Hits; 
-    U64 Searches; 
-    U64 Collisions; 
-    U64 Used; 
+    Move Mv; 
+    int Score; 
+    int Depth; 
+    NodeType Type; 
 };
 
-struct TTableEntry 
+/**
+ * Data layout: 
+ * move: 0-29 
+ * type: 30-32 
+ * depth: 33-40 
+ * age: 41-45 
+ * score: 46-63 (offset by TTableMaxScore + 1) 
+ */
+struct TTableSlot 
+{
+    atomic_ullong Key; // zobrist key XOR data 
+    atomic_ullong Data; 
+};
+
+struct TTableBucket 
+{
+    TTableSlot Slots[TTableBucketSize]; 
+};
+
+struct TTable 
 {
+    void* Memory; 
+    TTableBucket* Buckets; 
 #ifdef VALIDATION
-    Game State; 
+    Game* States; 
 #endif
-    Zobrist Key; 
-    Move Mv; 
-    int Score; 
-    unsigned char Depth; 
-    char Type; 
+    U64 Size; 
+    U64 Mask; 
+    int Age; 
 };
 
 /**
@@ -77,21 +125,30 @@ void CreateTTable(TTable* tt, U64 sizeInMb);
 void DestroyTTable(TTable* tt); 
 
 /**
- * Removes all table entries and clears stats. 
+ * Removes all table entries and resets the age. 
  * 
  * @param tt The table 
  */
 void ResetTTable(TTable* tt); 
 
+/**
+ * Starts a new search generation. Entries from older searches are 
+ * replaced before entries from the current one. 
+ * 
+ * @param tt The table 
+ */
+void NewTTableSearch(TTable* tt); 
+
 /**
  * Queries a table for an entry using a hash key. 
  * 
  * @param tt The table 
  * @param key Game state hash 
+ * @param entry Output for the entry data 
  * @param state Game state 
- * @return Entry if found, null otherwise
+ * @return True if found, false otherwise 
  */
-TTableEntry* FindTTableEntry(TTable* tt, Zobrist key, const Game* state); 
+bool FindTTableEntry(TTable* tt, Zobrist key, TTableEntry* entry, const Game* state); 
 
 /**
  * Updates a table entry. 
@@ -105,3 +162,11 @@ TTableEntry* FindTTableEntry(TTable* tt, Zobrist key, const Game* state);
  * @param state Game state 
  */
 void UpdateTTable(TTable* tt, Zobrist key, int type, int score, int depth, Move mv, const Game* state); 
+
+/**
+ * Estimates how full the table is with entries from the current search. 
+ * 
+ * @param tt The table 
+ * @return Permille of used entries 
+ */
+int GetTTableHashfull(const TTable* tt); 
@@ -879,1300 +879,3 @@ const Bitboard SlideTo[64][64] =
         0x7F00000000000000ULL, 0x7E00000000000000ULL, 0x7C00000000000000ULL, 0x7800000000000000ULL, 0x7000000000000000ULL, 0x6000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000000ULL, 
     },
 };
-
-const U64 Reverse8Offset[8][256] = 
-{
-    {
-        0x00ULL << 0, 0x80ULL << 0, 0x40ULL << 0, 0xC0ULL << 0, 0x20ULL << 0, 0xA0ULL << 0, 0x60ULL << 0, 0xE0ULL << 0, 
-        0x10ULL << 0, 0x90ULL << 0, 0x50ULL << 0, 0xD0ULL << 0, 0x30ULL << 0, 0xB0ULL << 0, 0x70ULL << 0, 0xF0ULL << 0, 
-        0x08ULL << 0, 0x88ULL << 0, 0x48ULL << 0, 0xC8ULL << 0, 0x28ULL << 0, 0xA8ULL << 0, 0x68ULL << 0, 0xE8ULL << 0, 
-        0x18ULL << 0, 0x98ULL << 0, 0x58ULL << 0, 0xD8ULL << 0, 0x38ULL << 0, 0xB8ULL << 0, 0x78ULL << 0, 0xF8ULL << 0, 
-        0x04ULL << 0, 0x84ULL << 0, 0x44ULL << 0, 0xC4ULL << 0, 0x24ULL << 0, 0xA4ULL << 0, 0x64ULL << 0, 0xE4ULL << 0, 
-        0x14ULL << 0, 0x94ULL << 0, 0x54ULL << 0, 0xD4ULL << 0, 0x34ULL << 0, 0xB4ULL << 0, 0x74ULL << 0, 0xF4ULL << 0, 
-        0x0CULL << 0, 0x8CULL << 0, 0x4CULL << 0, 0xCCULL << 0, 0x2CULL << 0, 0xACULL << 0, 0x6CULL << 0, 0xECULL << 0, 
-        0x1CULL << 0, 0x9CULL << 0, 0x5CULL << 0, 0xDCULL << 0, 0x3CULL << 0, 0xBCULL << 0, 0x7CULL << 0, 0xFCULL << 0, 
-        0x02ULL << 0, 0x82ULL << 0, 0x42ULL << 0, 0xC2ULL << 0, 0x22ULL << 0, 0xA2ULL << 0, 0x62ULL << 0, 0xE2ULL << 0, 
-        0x12ULL << 0, 0x92ULL << 0, 0x52ULL << 0, 0xD2ULL << 0, 0x32ULL << 0, 0xB2ULL << 0, 0x72ULL << 0, 0xF2ULL << 0, 
-        0x0AULL << 0, 0x8AULL << 0, 0x4AULL << 0, 0xCAULL << 0, 0x2AULL << 0, 0xAAULL << 0, 0x6AULL << 0, 0xEAULL << 0, 
-        0x1AULL << 0, 0x9AULL << 0, 0x5AULL << 0, 0xDAULL << 0, 0x3AULL << 0, 0xBAULL << 0, 0x7AULL << 0, 0xFAULL << 0, 
-        0x06ULL << 0, 0x86ULL << 0, 0x46ULL << 0, 0xC6ULL << 0, 0x26ULL << 0, 0xA6ULL << 0, 0x66ULL << 0, 0xE6ULL << 0, 
-        0x16ULL << 0, 0x96ULL << 0, 0x56ULL << 0, 0xD6ULL << 0, 0x36ULL << 0, 0xB6ULL << 0, 0x76ULL << 0, 0xF6ULL << 0, 
-        0x0EULL << 0, 0x8EULL << 0, 0x4EULL << 0, 0xCEULL << 0, 0x2EULL << 0, 0xAEULL << 0, 0x6EULL << 0, 0xEEULL << 0, 
-        0x1EULL << 0, 0x9EULL << 0, 0x5EULL << 0, 0xDEULL << 0, 0x3EULL << 0, 0xBEULL << 0, 0x7EULL << 0, 0xFEULL << 0, 
-        0x01ULL << 0, 0x81ULL << 0, 0x41ULL << 0, 0xC1ULL << 0, 0x21ULL << 0, 0xA1ULL << 0, 0x61ULL << 0, 0xE1ULL << 0, 
-        0x11ULL << 0, 0x91ULL << 0, 0x51ULL << 0, 0xD1ULL << 0, 0x31ULL << 0, 0xB1ULL << 0, 0x71ULL << 0, 0xF1ULL << 0, 
-        0x09ULL << 0, 0x89ULL << 0, 0x49ULL << 0, 0xC9ULL << 0, 0x29ULL << 0, 0xA9ULL << 0, 0x69ULL << 0, 0xE9ULL << 0, 
-        0x19ULL << 0, 0x99ULL << 0, 0x59ULL << 0, 0xD9ULL << 0, 0x39ULL << 0, 0xB9ULL << 0, 0x79ULL << 0, 0xF9ULL << 0, 
-        0x05ULL << 0, 0x85ULL << 0, 0x45ULL << 0, 0xC5ULL << 0, 0x25ULL << 0, 0xA5ULL << 0, 0x65ULL << 0, 0xE5ULL << 0, 
-        0x15ULL << 0, 0x95ULL << 0, 0x55ULL << 0, 0xD5ULL << 0, 0x35ULL << 0, 0xB5ULL << 0, 0x75ULL << 0, 0xF5ULL << 0, 
-        0x0DULL << 0, 0x8DULL << 0, 0x4DULL << 0, 0xCDULL << 0, 0x2DULL << 0, 0xADULL << 0, 0x6DULL << 0, 0xEDULL << 0, 
-        0x1DULL << 0, 0x9DULL << 0, 0x5DULL << 0, 0xDDULL << 0, 0x3DULL << 0, 0xBDULL << 0, 0x7DULL << 0, 0xFDULL << 0, 
-        0x03ULL << 0, 0x83ULL << 0, 0x43ULL << 0, 0xC3ULL << 0, 0x23ULL << 0, 0xA3ULL << 0, 0x63ULL << 0, 0xE3ULL << 0, 
-        0x13ULL << 0, 0x93ULL << 0, 0x53ULL << 0, 0xD3ULL << 0, 0x33ULL << 0, 0xB3ULL << 0, 0x73ULL << 0, 0xF3ULL << 0, 
-        0x0BULL << 0, 0x8BULL << 0, 0x4BULL << 0, 0xCBULL << 0, 0x2BULL << 0, 0xABULL << 0, 0x6BULL << 0, 0xEBULL << 0, 
-        0x1BULL << 0, 0x9BULL << 0, 0x5BULL << 0, 0xDBULL << 0, 0x3BULL << 0, 0xBBULL << 0, 0x7BULL << 0, 0xFBULL << 0, 
-        0x07ULL << 0, 0x87ULL << 0, 0x47ULL << 0, 0xC7ULL << 0, 0x27ULL << 0, 0xA7ULL << 0, 0x67ULL << 0, 0xE7ULL << 0, 
-        0x17ULL << 0, 0x97ULL << 0, 0x57ULL << 0, 0xD7ULL << 0, 0x37ULL << 0, 0xB7ULL << 0, 0x77ULL << 0, 0xF7ULL << 0, 
-        0x0FULL << 0, 0x8FULL << 0, 0x4FULL << 0, 0xCFULL << 0, 0x2FULL << 0, 0xAFULL << 0, 0x6FULL << 0, 0xEFULL << 0, 
-        0x1FULL << 0, 0x9FULL << 0, 0x5FULL << 0, 0xDFULL << 0, 0x3FULL << 0, 0xBFULL << 0, 0x7FULL << 0, 0xFFULL << 0, 
-    },{
-        0x00ULL << 8, 0x80ULL << 8, 0x40ULL << 8, 0xC0ULL << 8, 0x20ULL << 8, 0xA0ULL << 8, 0x60ULL << 8, 0xE0ULL << 8, 
-        0x10ULL << 8, 0x90ULL << 8, 0x50ULL << 8, 0xD0ULL << 8, 0x30ULL << 8, 0xB0ULL << 8, 0x70ULL << 8, 0xF0ULL << 8, 
-        0x08ULL << 8, 0x88ULL << 8, 0x48ULL << 8, 0xC8ULL << 8, 0x28ULL << 8, 0xA8ULL << 8, 0x68ULL << 8, 0xE8ULL << 8, 
-        0x18ULL << 8, 0x98ULL << 8, 0x58ULL << 8, 0xD8ULL << 8, 0x38ULL << 8, 0xB8ULL << 8, 0x78ULL << 8, 0xF8ULL << 8, 
-        0x04ULL << 8, 0x84ULL << 8, 0x44ULL << 8, 0xC4ULL << 8, 0x24ULL << 8, 0xA4ULL << 8, 0x64ULL << 8, 0xE4ULL << 8, 
-        0x14ULL << 8, 0x94ULL << 8, 0x54ULL << 8, 0xD4ULL << 8, 0x34ULL << 8, 0xB4ULL << 8, 0x74ULL << 8, 0xF4ULL << 8, 
-        0x0CULL << 8, 0x8CULL << 8, 0x4CULL << 8, 0xCCULL << 8, 0x2CULL << 8, 0xACULL << 8, 0x6CULL << 8, 0xECULL << 8, 
-        0x1CULL << 8, 0x9CULL << 8, 0x5CULL << 8, 0xDCULL << 8, 0x3CULL << 8, 0xBCULL << 8, 0x7CULL << 8, 0xFCULL << 8, 
-        0x02ULL << 8, 0x82ULL << 8, 0x42ULL << 8, 0xC2ULL << 8, 0x22ULL << 8, 0xA2ULL << 8, 0x62ULL << 8, 0xE2ULL << 8, 
-        0x12ULL << 8, 0x92ULL << 8, 0x52ULL << 8, 0xD2ULL << 8, 0x32ULL << 8, 0xB2ULL << 8, 0x72ULL << 8, 0xF2ULL << 8, 
-        0x0AULL << 8, 0x8AULL << 8, 0x4AULL << 8, 0xCAULL << 8, 0x2AULL << 8, 0xAAULL << 8, 0x6AULL << 8, 0xEAULL << 8, 
-        0x1AULL << 8, 0x9AULL << 8, 0x5AULL << 8, 0xDAULL << 8, 0x3AULL << 8, 0xBAULL << 8, 0x7AULL << 8, 0xFAULL << 8, 
-        0x06ULL << 8, 0x86ULL << 8, 0x46ULL << 8, 0xC6ULL << 8, 0x26ULL << 8, 0xA6ULL << 8, 0x66ULL << 8, 0xE6ULL << 8, 
-        0x16ULL << 8, 0x96ULL << 8, 0x56ULL << 8, 0xD6ULL << 8, 0x36ULL << 8, 0xB6ULL << 8, 0x76ULL << 8, 0xF6ULL << 8, 
-        0x0EULL << 8, 0x8EULL << 8, 0x4EULL << 8, 0xCEULL << 8, 0x2EULL << 8, 0xAEULL << 8, 0x6EULL << 8, 0xEEULL << 8, 
-        0x1EULL << 8, 0x9EULL << 8, 0x5EULL << 8, 0xDEULL << 8, 0x3EULL << 8, 0xBEULL << 8, 0x7EULL << 8, 0xFEULL << 8, 
-        0x01ULL << 8, 0x81ULL << 8, 0x41ULL << 8, 0xC1ULL << 8, 0x21ULL << 8, 0xA1ULL << 8, 0x61ULL << 8, 0xE1ULL << 8, 
-        0x11ULL << 8, 0x91ULL << 8, 0x51ULL << 8, 0xD1ULL << 8, 0x31ULL << 8, 0xB1ULL << 8, 0x71ULL << 8, 0xF1ULL << 8, 
-        0x09ULL << 8, 0x89ULL << 8, 0x49ULL << 8, 0xC9ULL << 8, 0x29ULL << 8, 0xA9ULL << 8, 0x69ULL << 8, 0xE9ULL << 8, 
-        0x19ULL << 8, 0x99ULL << 8, 0x59ULL << 8, 0xD9ULL << 8, 0x39ULL << 8, 0xB9ULL << 8, 0x79ULL << 8, 0xF9ULL << 8, 
-        0x05ULL << 8, 0x85ULL << 8, 0x45ULL << 8, 0xC5ULL << 8, 0x25ULL << 8, 0xA5ULL << 8, 0x65ULL << 8, 0xE5ULL << 8, 
-        0x15ULL << 8, 0x95ULL << 8, 0x55ULL << 8, 0xD5ULL << 8, 0x35ULL << 8, 0xB5ULL << 8, 0x75ULL << 8, 0xF5ULL << 8, 
-        0x0DULL << 8, 0x8DULL << 8, 0x4DULL << 8, 0xCDULL << 8, 0x2DULL << 8, 0xADULL << 8, 0x6DULL << 8, 0xEDULL << 8, 
-        0x1DULL << 8, 0x9DULL << 8, 0x5DULL << 8, 0xDDULL << 8, 0x3DULL << 8, 0xBDULL << 8, 0x7DULL << 8, 0xFDULL << 8, 
-        0x03ULL << 8, 0x83ULL << 8, 0x43ULL << 8, 0xC3ULL << 8, 0x23ULL << 8, 0xA3ULL << 8, 0x63ULL << 8, 0xE3ULL << 8, 
-        0x13ULL << 8, 0x93ULL << 8, 0x53ULL << 8, 0xD3ULL << 8, 0x33ULL << 8, 0xB3ULL << 8, 0x73ULL << 8, 0xF3ULL << 8, 
-        0x0BULL << 8, 0x8BULL << 8, 0x4BULL << 8, 0xCBULL << 8, 0x2BULL << 8, 0xABULL << 8, 0x6BULL << 8, 0xEBULL << 8, 
-        0x1BULL << 8, 0x9BULL << 8, 0x5BULL << 8, 0xDBULL << 8, 0x3BULL << 8, 0xBBULL << 8, 0x7BULL << 8, 0xFBULL << 8, 
-        0x07ULL << 8, 0x87ULL << 8, 0x47ULL << 8, 0xC7ULL << 8, 0x27ULL << 8, 0xA7ULL << 8, 0x67ULL << 8, 0xE7ULL << 8, 
-        0x17ULL << 8, 0x97ULL << 8, 0x57ULL << 8, 0xD7ULL << 8, 0x37ULL << 8, 0xB7ULL << 8, 0x77ULL << 8, 0xF7ULL << 8, 
-        0x0FULL << 8, 0x8FULL << 8, 0x4FULL << 8, 0xCFULL << 8, 0x2FULL << 8, 0xAFULL << 8, 0x6FULL << 8, 0xEFULL << 8, 
-        0x1FULL << 8, 0x9FULL << 8, 0x5FULL << 8, 0xDFULL << 8, 0x3FULL << 8, 0xBFULL << 8, 0x7FULL << 8, 0xFFULL << 8, 
-    },{
-        0x00ULL << 16, 0x80ULL << 16, 0x40ULL << 16, 0xC0ULL << 16, 0x20ULL << 16, 0xA0ULL << 16, 0x60ULL << 16, 0xE0ULL << 16, 
-        0x10ULL << 16, 0x90ULL << 16, 0x50ULL << 16, 0xD0ULL << 16, 0x30ULL << 16, 0xB0ULL << 16, 0x70ULL << 16, 0xF0ULL << 16, 
-        0x08ULL << 16, 0x88ULL << 16, 0x48ULL << 16, 0xC8ULL << 16, 0x28ULL << 16, 0xA8ULL << 16, 0x68ULL << 16, 0xE8ULL << 16, 
-        0x18ULL << 16, 0x98ULL << 16, 0x58ULL << 16, 0xD8ULL << 16, 0x38ULL << 16, 0xB8ULL << 16, 0x78ULL << 16, 0xF8ULL << 16, 
-        0x04ULL << 16, 0x84ULL << 16, 0x44ULL << 16, 0xC4ULL << 16, 0x24ULL << 16, 0xA4ULL << 16, 0x64ULL << 16, 0xE4ULL << 16, 
-        0x14ULL << 16, 0x94ULL << 16, 0x54ULL << 16, 0xD4ULL << 16, 0x34ULL << 16, 0xB4ULL << 16, 0x74ULL << 16, 0xF4ULL << 16, 
-        0x0CULL << 16, 0x8CULL << 16, 0x4CULL << 16, 0xCCULL << 16, 0x2CULL << 16, 0xACULL << 16, 0x6CULL << 16, 0xECULL << 16, 
-        0x1CULL << 16, 0x9CULL << 16, 0x5CULL << 16, 0xDCULL << 16, 0x3CULL << 16, 0xBCULL << 16, 0x7CULL << 16, 0xFCULL << 16, 
-        0x02ULL << 16, 0x82ULL << 16, 0x42ULL << 16, 0xC2ULL << 16, 0x22ULL << 16, 0xA2ULL << 16, 0x62ULL << 16, 0xE2ULL << 16, 
-        0x12ULL << 16, 0x92ULL << 16, 0x52ULL << 16, 0xD2ULL << 16, 0x32ULL << 16, 0xB2ULL << 16, 0x72ULL << 16, 0xF2ULL << 16, 
-        0x0AULL << 16, 0x8AULL << 16, 0x4AULL << 16, 0xCAULL << 16, 0x2AULL << 16, 0xAAULL << 16, 0x6AULL << 16, 0xEAULL << 16, 
-        0x1AULL << 16, 0x9AULL << 16, 0x5AULL << 16, 0xDAULL << 16, 0x3AULL << 16, 0xBAULL << 16, 0x7AULL << 16, 0xFAULL << 16, 
-        0x06ULL << 16, 0x86ULL << 16, 0x46ULL << 16, 0xC6ULL << 16, 0x26ULL << 16, 0xA6ULL << 16, 0x66ULL << 16, 0xE6ULL << 16, 
-        0x16ULL << 16, 0x96ULL << 16, 0x56ULL << 16, 0xD6ULL << 16, 0x36ULL << 16, 0xB6ULL << 16, 0x76ULL << 16, 0xF6ULL << 16, 
-        0x0EULL << 16, 0x8EULL << 16, 0x4EULL << 16, 0xCEULL << 16, 0x2EULL << 16, 0xAEULL << 16, 0x6EULL << 16, 0xEEULL << 16, 
-        0x1EULL << 16, 0x9EULL << 16, 0x5EULL << 16, 0xDEULL << 16, 0x3EULL << 16, 0xBEULL << 16, 0x7EULL << 16, 0xFEULL << 16, 
-        0x01ULL << 16, 0x81ULL << 16, 0x41ULL << 16, 0xC1ULL << 16, 0x21ULL << 16, 0xA1ULL << 16, 0x61ULL << 16, 0xE1ULL << 16, 
-        0x11ULL << 16, 0x91ULL << 16, 0x51ULL << 16, 0xD1ULL << 16, 0x31ULL << 16, 0xB1ULL << 16, 0x71ULL << 16, 0xF1ULL << 16, 
-        0x09ULL << 16, 0x89ULL << 16, 0x49ULL << 16, 0xC9ULL << 16, 0x29ULL << 16, 0xA9ULL << 16, 0x69ULL << 16, 0xE9ULL << 16, 
-        0x19ULL << 16, 0x99ULL << 16, 0x59ULL << 16, 0xD9ULL << 16, 0x39ULL << 16, 0xB9ULL << 16, 0x79ULL << 16, 0xF9ULL << 16, 
-        0x05ULL << 16, 0x85ULL << 16, 0x45ULL << 16, 0xC5ULL << 16, 0x25ULL << 16, 0xA5ULL << 16, 0x65ULL << 16, 0xE5ULL << 16, 
-        0x15ULL << 16, 0x95ULL << 16, 0x55ULL << 16, 0xD5ULL << 16, 0x35ULL << 16, 0xB5ULL << 16, 0x75ULL << 16, 0xF5ULL << 16, 
-        0x0DULL << 16, 0x8DULL << 16, 0x4DULL << 16, 0xCDULL << 16, 0x2DULL << 16, 0xADULL << 16, 0x6DULL << 16, 0xEDULL << 16, 
-        0x1DULL << 16, 0x9DULL << 16, 0x5DULL << 16, 0xDDULL << 16, 0x3DULL << 16, 0xBDULL << 16, 0x7DULL << 16, 0xFDULL << 16, 
-        0x03ULL << 16, 0x83ULL << 16, 0x43ULL << 16, 0xC3ULL << 16, 0x23ULL << 16, 0xA3ULL << 16, 0x63ULL << 16, 0xE3ULL << 16, 
-        0x13ULL << 16, 0x93ULL << 16, 0x53ULL << 16, 0xD3ULL << 16, 0x33ULL << 16, 0xB3ULL << 16, 0x73ULL << 16, 0xF3ULL << 16, 
-        0x0BULL << 16, 0x8BULL << 16, 0x4BULL << 16, 0xCBULL << 16, 0x2BULL << 16, 0xABULL << 16, 0x6BULL << 16, 0xEBULL << 16, 
-        0x1BULL << 16, 0x9BULL << 16, 0x5BULL << 16, 0xDBULL << 16, 0x3BULL << 16, 0xBBULL << 16, 0x7BULL << 16, 0xFBULL << 16, 
-        0x07ULL << 16, 0x87ULL << 16, 0x47ULL << 16, 0xC7ULL << 16, 0x27ULL << 16, 0xA7ULL << 16, 0x67ULL << 16, 0xE7ULL << 16, 
-        0x17ULL << 16, 0x97ULL << 16, 0x57ULL << 16, 0xD7ULL << 16, 0x37ULL << 16, 0xB7ULL << 16, 0x77ULL << 16, 0xF7ULL << 16, 
-        0x0FULL << 16, 0x8FULL << 16, 0x4FULL << 16, 0xCFULL << 16, 0x2FULL << 16, 0xAFULL << 16, 0x6FULL << 16, 0xEFULL << 16, 
-        0x1FULL << 16, 0x9FULL << 16, 0x5FULL << 16, 0xDFULL << 16, 0x3FULL << 16, 0xBFULL << 16, 0x7FULL << 16, 0xFFULL << 16, 
-    },{
-        0x00ULL << 24, 0x80ULL << 24, 0x40ULL << 24, 0xC0ULL << 24, 0x20ULL << 24, 0xA0ULL << 24, 0x60ULL << 24, 0xE0ULL << 24, 
-        0x10ULL << 24, 0x90ULL << 24, 0x50ULL << 24, 0xD0ULL << 24, 0x30ULL << 24, 0xB0ULL << 24, 0x70ULL << 24, 0xF0ULL << 24, 
-        0x08ULL << 24, 0x88ULL << 24, 0x48ULL << 24, 0xC8ULL << 24, 0x28ULL << 24, 0xA8ULL << 24, 0x68ULL << 24, 0xE8ULL << 24, 
-        0x18ULL << 24, 0x98ULL << 24, 0x58ULL << 24, 0xD8ULL << 24, 0x38ULL << 24, 0xB8ULL << 24, 0x78ULL << 24, 0xF8ULL << 24, 
-        0x04ULL << 24, 0x84ULL << 24, 0x44ULL << 24, 0xC4ULL << 24, 0x24ULL << 24, 0xA4ULL << 24, 0x64ULL << 24, 0xE4ULL << 24, 
-        0x14ULL << 24, 0x94ULL << 24, 0x54ULL << 24, 0xD4ULL << 24, 0x34ULL << 24, 0xB4ULL << 24, 0x74ULL << 24, 0xF4ULL << 24, 
-        0x0CULL << 24, 0x8CULL << 24, 0x4CULL << 24, 0xCCULL << 24, 0x2CULL << 24, 0xACULL << 24, 0x6CULL << 24, 0xECULL << 24, 
-        0x1CULL << 24, 0x9CULL << 24, 0x5CULL << 24, 0xDCULL << 24, 0x3CULL << 24, 0xBCULL << 24, 0x7CULL << 24, 0xFCULL << 24, 
-        0x02ULL << 24, 0x82ULL << 24, 0x42ULL << 24, 0xC2ULL << 24, 0x22ULL << 24, 0xA2ULL << 24, 0x62ULL << 24, 0xE2ULL << 24, 
-        0x12ULL << 24, 0x92ULL << 24, 0x52ULL << 24, 0xD2ULL << 24, 0x32ULL << 24, 0xB2ULL << 24, 0x72ULL << 24, 0xF2ULL << 24, 
-        0x0AULL << 24, 0x8AULL << 24, 0x4AULL << 24, 0xCAULL << 24, 0x2AULL << 24, 0xAAULL << 24, 0x6AULL << 24, 0xEAULL << 24, 
-        0x1AULL << 24, 0x9AULL << 24, 0x5AULL << 24, 0xDAULL << 24, 0x3AULL << 24, 0xBAULL << 24, 0x7AULL << 24, 0xFAULL << 24, 
-        0x06ULL << 24, 0x86ULL << 24, 0x46ULL << 24, 0xC6ULL << 24, 0x26ULL << 24, 0xA6ULL << 24, 0x66ULL << 24, 0xE6ULL << 24, 
-        0x16ULL << 24, 0x96ULL << 24, 0x56ULL << 24, 0xD6ULL << 24, 0x36ULL << 24, 0xB6ULL << 24, 0x76ULL << 24, 0xF6ULL << 24, 
-        0x0EULL << 24, 0x8EULL << 24, 0x4EULL << 24, 0xCEULL << 24, 0x2EULL << 24, 0xAEULL << 24, 0x6EULL << 24, 0xEEULL << 24, 
-        0x1EULL << 24, 0x9EULL << 24, 0x5EULL << 24, 0xDEULL << 24, 0x3EULL << 24, 0xBEULL << 24, 0x7EULL << 24, 0xFEULL << 24, 
-        0x01ULL << 24, 0x81ULL << 24, 0x41ULL << 24, 0xC1ULL << 24, 0x21ULL << 24, 0xA1ULL << 24, 0x61ULL << 24, 0xE1ULL << 24, 
-        0x11ULL << 24, 0x91ULL << 24, 0x51ULL << 24, 0xD1ULL << 24, 0x31ULL << 24, 0xB1ULL << 24, 0x71ULL << 24, 0xF1ULL << 24, 
-        0x09ULL << 24, 0x89ULL << 24, 0x49ULL << 24, 0xC9ULL << 24, 0x29ULL << 24, 0xA9ULL << 24, 0x69ULL << 24, 0xE9ULL << 24, 
-        0x19ULL << 24, 0x99ULL << 24, 0x59ULL << 24, 0xD9ULL << 24, 0x39ULL << 24, 0xB9ULL << 24, 0x79ULL << 24, 0xF9ULL << 24, 
-        0x05ULL << 24, 0x85ULL << 24, 0x45ULL << 24, 0xC5ULL << 24, 0x25ULL << 24, 0xA5ULL << 24, 0x65ULL << 24, 0xE5ULL << 24, 
-        0x15ULL << 24, 0x95ULL << 24, 0x55ULL << 24, 0xD5ULL << 24, 0x35ULL << 24, 0xB5ULL << 24, 0x75ULL << 24, 0xF5ULL << 24, 
-        0x0DULL << 24, 0x8DULL << 24, 0x4DULL << 24, 0xCDULL << 24, 0x2DULL << 24, 0xADULL << 24, 0x6DULL << 24, 0xEDULL << 24, 
-        0x1DULL << 24, 0x9DULL << 24, 0x5DULL << 24, 0xDDULL << 24, 0x3DULL << 24, 0xBDULL << 24, 0x7DULL << 24, 0xFDULL << 24, 
-        0x03ULL << 24, 0x83ULL << 24, 0x43ULL << 24, 0xC3ULL << 24, 0x23ULL << 24, 0xA3ULL << 24, 0x63ULL << 24, 0xE3ULL << 24, 
-        0x13ULL << 24, 0x93ULL << 24, 0x53ULL << 24, 0xD3ULL << 24, 0x33ULL << 24, 0xB3ULL << 24, 0x73ULL << 24, 0xF3ULL << 24, 
-        0x0BULL << 24, 0x8BULL << 24, 0x4BULL << 24, 0xCBULL << 24, 0x2BULL << 24, 0xABULL << 24, 0x6BULL << 24, 0xEBULL << 24, 
-        0x1BULL << 24, 0x9BULL << 24, 0x5BULL << 24, 0xDBULL << 24, 0x3BULL << 24, 0xBBULL << 24, 0x7BULL << 24, 0xFBULL << 24, 
-        0x07ULL << 24, 0x87ULL << 24, 0x47ULL << 24, 0xC7ULL << 24, 0x27ULL << 24, 0xA7ULL << 24, 0x67ULL << 24, 0xE7ULL << 24, 
-        0x17ULL << 24, 0x97ULL << 24, 0x57ULL << 24, 0xD7ULL << 24, 0x37ULL << 24, 0xB7ULL << 24, 0x77ULL << 24, 0xF7ULL << 24, 
-        0x0FULL << 24, 0x8FULL << 24, 0x4FULL << 24, 0xCFULL << 24, 0x2FULL << 24, 0xAFULL << 24, 0x6FULL << 24, 0xEFULL << 24, 
-        0x1FULL << 24, 0x9FULL << 24, 0x5FULL << 24, 0xDFULL << 24, 0x3FULL << 24, 0xBFULL << 24, 0x7FULL << 24, 0xFFULL << 24, 
-    },{
-        0x00ULL << 32, 0x80ULL << 32, 0x40ULL << 32, 0xC0ULL << 32, 0x20ULL << 32, 0xA0ULL << 32, 0x60ULL << 32, 0xE0ULL << 32, 
-        0x10ULL << 32, 0x90ULL << 32, 0x50ULL << 32, 0xD0ULL << 32, 0x30ULL << 32, 0xB0ULL << 32, 0x70ULL << 32, 0xF0ULL << 32, 
-        0x08ULL << 32, 0x88ULL << 32, 0x48ULL << 32, 0xC8ULL << 32, 0x28ULL << 32, 0xA8ULL << 32, 0x68ULL << 32, 0xE8ULL << 32, 
-        0x18ULL << 32, 0x98ULL << 32, 0x58ULL << 32, 0xD8ULL << 32, 0x38ULL << 32, 0xB8ULL << 32, 0x78ULL << 32, 0xF8ULL << 32, 
-        0x04ULL << 32, 0x84ULL << 32, 0x44ULL << 32, 0xC4ULL << 32, 0x24ULL << 32, 0xA4ULL << 32, 0x64ULL << 32, 0xE4ULL << 32, 
-        0x14ULL << 32, 0x94ULL << 32, 0x54ULL << 32, 0xD4ULL << 32, 0x34ULL << 32, 0xB4ULL << 32, 0x74ULL << 32, 0xF4ULL << 32, 
-        0x0CULL << 32, 0x8CULL << 32, 0x4CULL << 32, 0xCCULL << 32, 0x2CULL << 32, 0xACULL << 32, 0x6CULL << 32, 0xECULL << 32, 
-        0x1CULL << 32, 0x9CULL << 32, 0x5CULL << 32, 0xDCULL << 32, 0x3CULL << 32, 0xBCULL << 32, 0x7CULL << 32, 0xFCULL << 32, 
-        0x02ULL << 32, 0x82ULL << 32, 0x42ULL << 32, 0xC2ULL << 32, 0x22ULL << 32, 0xA2ULL << 32, 0x62ULL << 32, 0xE2ULL << 32, 
-        0x12ULL << 32, 0x92ULL << 32, 0x52ULL << 32, 0xD2ULL << 32, 0x32ULL << 32, 0xB2ULL << 32, 0x72ULL << 32, 0xF2ULL << 32, 
-        0x0AULL << 32, 0x8AULL << 32, 0x4AULL << 32, 0xCAULL << 32, 0x2AULL << 32, 0xAAULL << 32, 0x6AULL << 32, 0xEAULL << 32, 
-        0x1AULL << 32, 0x9AULL << 32, 0x5AULL << 32, 0xDAULL << 32, 0x3AULL << 32, 0xBAULL << 32, 0x7AULL << 32, 0xFAULL << 32, 
-        0x06ULL << 32, 0x86ULL << 32, 0x46ULL << 32, 0xC6ULL << 32, 0x26ULL << 32, 0xA6ULL << 32, 0x66ULL << 32, 0xE6ULL << 32, 
-        0x16ULL << 32, 0x96ULL << 32, 0x56ULL << 32, 0xD6ULL << 32, 0x36ULL << 32, 0xB6ULL << 32, 0x76ULL << 32, 0xF6ULL << 32, 
-        0x0EULL << 32, 0x8EULL << 32, 0x4EULL << 32, 0xCEULL << 32, 0x2EULL << 32, 0xAEULL << 32, 0x6EULL << 32, 0xEEULL << 32, 
-        0x1EULL << 32, 0x9EULL << 32, 0x5EULL << 32, 0xDEULL << 32, 0x3EULL << 32, 0xBEULL << 32, 0x7EULL << 32, 0xFEULL << 32, 
-        0x01ULL << 32, 0x81ULL << 32, 0x41ULL << 32, 0xC1ULL << 32, 0x21ULL << 32, 0xA1ULL << 32, 0x61ULL << 32, 0xE1ULL << 32, 
-        0x11ULL << 32, 0x91ULL << 32, 0x51ULL << 32, 0xD1ULL << 32, 0x31ULL << 32, 0xB1ULL << 32, 0x71ULL << 32, 0xF1ULL << 32, 
-        0x09ULL << 32, 0x89ULL << 32, 0x49ULL << 32, 0xC9ULL << 32, 0x29ULL << 32, 0xA9ULL << 32, 0x69ULL << 32, 0xE9ULL << 32, 
-        0x19ULL << 32, 0x99ULL << 32, 0x59ULL << 32, 0xD9ULL << 32, 0x39ULL << 32, 0xB9ULL << 32, 0x79ULL << 32, 0xF9ULL << 32, 
-        0x05ULL << 32, 0x85ULL << 32, 0x45ULL << 32, 0xC5ULL << 32, 0x25ULL << 32, 0xA5ULL << 32, 0x65ULL << 32, 0xE5ULL << 32, 
-        0x15ULL << 32, 0x95ULL << 32, 0x55ULL << 32, 0xD5ULL << 32, 0x35ULL << 32, 0xB5ULL << 32, 0x75ULL << 32, 0xF5ULL << 32, 
-        0x0DULL << 32, 0x8DULL << 32, 0x4DULL << 32, 0xCDULL << 32, 0x2DULL << 32, 0xADULL << 32, 0x6DULL << 32, 0xEDULL << 32, 
-        0x1DULL << 32, 0x9DULL << 32, 0x5DULL << 32, 0xDDULL << 32, 0x3DULL << 32, 0xBDULL << 32, 0x7DULL << 32, 0xFDULL << 32, 
-        0x03ULL << 32, 0x83ULL << 32, 0x43ULL << 32, 0xC3ULL << 32, 0x23ULL << 32, 0xA3ULL << 32, 0x63ULL << 32, 0xE3ULL << 32, 
-        0x13ULL << 32, 0x93ULL << 32, 0x53ULL << 32, 0xD3ULL << 32, 0x33ULL << 32, 0xB3ULL << 32, 0x73ULL << 32, 0xF3ULL << 32, 
-        0x0BULL << 32, 0x8BULL << 32, 0x4BULL << 32, 0xCBULL << 32, 0x2BULL << 32, 0xABULL << 32, 0x6BULL << 32, 0xEBULL << 32, 
-        0x1BULL << 32, 0x9BULL << 32, 0x5BULL << 32, 0xDBULL << 32, 0x3BULL << 32, 0xBBULL << 32, 0x7BULL << 32, 0xFBULL << 32, 
-        0x07ULL << 32, 0x87ULL << 32, 0x47ULL << 32, 0xC7ULL << 32, 0x27ULL << 32, 0xA7ULL << 32, 0x67ULL << 32, 0xE7ULL << 32, 
-        0x17ULL << 32, 0x97ULL << 32, 0x57ULL << 32, 0xD7ULL << 32, 0x37ULL << 32, 0xB7ULL << 32, 0x77ULL << 32, 0xF7ULL << 32, 
-        0x0FULL << 32, 0x8FULL << 32, 0x4FULL << 32, 0xCFULL << 32, 0x2FULL << 32, 0xAFULL << 32, 0x6FULL << 32, 0xEFULL << 32, 
-        0x1FULL << 32, 0x9FULL << 32, 0x5FULL << 32, 0xDFULL << 32, 0x3FULL << 32, 0xBFULL << 32, 0x7FULL << 32, 0xFFULL << 32, 
-    },{
-        0x00ULL << 40, 0x80ULL << 40, 0x40ULL << 40, 0xC0ULL << 40, 0x20ULL << 40, 0xA0ULL << 40, 0x60ULL << 40, 0xE0ULL << 40, 
-        0x10ULL << 40, 0x90ULL << 40, 0x50ULL << 40, 0xD0ULL << 40, 0x30ULL << 40, 0xB0ULL << 40, 0x70ULL << 40, 0xF0ULL << 40, 
-        0x08ULL << 40, 0x88ULL << 40, 0x48ULL << 40, 0xC8ULL << 40, 0x28ULL << 40, 0xA8ULL << 40, 0x68ULL << 40, 0xE8ULL << 40, 
-        0x18ULL << 40, 0x98ULL << 40, 0x58ULL << 40, 0xD8ULL << 40, 0x38ULL << 40, 0xB8ULL << 40, 0x78ULL << 40, 0xF8ULL << 40, 
-        0x04ULL << 40, 0x84ULL << 40, 0x44ULL << 40, 0xC4ULL << 40, 0x24ULL << 40, 0xA4ULL << 40, 0x64ULL << 40, 0xE4ULL << 40, 
-        0x14ULL << 40, 0x94ULL << 40, 0x54ULL << 40, 0xD4ULL << 40, 0x34ULL << 40, 0xB4ULL << 40, 0x74ULL << 40, 0xF4ULL << 40, 
-        0x0CULL << 40, 0x8CULL << 40, 0x4CULL << 40, 0xCCULL << 40, 0x2CULL << 40, 0xACULL << 40, 0x6CULL << 40, 0xECULL << 40, 
-        0x1CULL << 40, 0x9CULL << 40, 0x5CULL << 40, 0xDCULL << 40, 0x3CULL << 40, 0xBCULL << 40, 0x7CULL << 40, 0xFCULL << 40, 
-        0x02ULL << 40, 0x82ULL << 40, 0x42ULL << 40, 0xC2ULL << 40, 0x22ULL << 40, 0xA2ULL << 40, 0x62ULL << 40, 0xE2ULL << 40, 
-        0x12ULL << 40, 0x92ULL << 40, 0x52ULL << 40, 0xD2ULL << 40, 0x32ULL << 40, 0xB2ULL << 40, 0x72ULL << 40, 0xF2ULL << 40, 
-        0x0AULL << 40, 0x8AULL << 40, 0x4AULL << 40, 0xCAULL << 40, 0x2AULL << 40, 0xAAULL << 40, 0x6AULL << 40, 0xEAULL << 40, 
-        0x1AULL << 40, 0x9AULL << 40, 0x5AULL << 40, 0xDAULL << 40, 0x3AULL << 40, 0xBAULL << 40, 0x7AULL << 40, 0xFAULL << 40, 
-        0x06ULL << 40, 0x86ULL << 40, 0x46ULL << 40, 0xC6ULL << 40, 0x26ULL << 40, 0xA6ULL << 40, 0x66ULL << 40, 0xE6ULL << 40, 
-        0x16ULL << 40, 0x96ULL << 40, 0x56ULL << 40, 0xD6ULL << 40, 0x36ULL << 40, 0xB6ULL << 40, 0x76ULL << 40, 0xF6ULL << 40, 
-        0x0EULL << 40, 0x8EULL << 40, 0x4EULL << 40, 0xCEULL << 40, 0x2EULL << 40, 0xAEULL << 40, 0x6EULL << 40, 0xEEULL << 40, 
-        0x1EULL << 40, 0x9EULL << 40, 0x5EULL << 40, 0xDEULL << 40, 0x3EULL << 40, 0xBEULL << 40, 0x7EULL << 40, 0xFEULL << 40, 
-        0x01ULL << 40, 0x81ULL << 40, 0x41ULL << 40, 0xC1ULL << 40, 0x21ULL << 40, 0xA1ULL << 40, 0x61ULL << 40, 0xE1ULL << 40, 
-        0x11ULL << 40, 0x91ULL << 40, 0x51ULL << 40, 0xD1ULL << 40, 0x31ULL << 40, 0xB1ULL << 40, 0x71ULL << 40, 0xF1ULL << 40, 
-        0x09ULL << 40, 0x89ULL << 40, 0x49ULL << 40, 0xC9ULL << 40, 0x29ULL << 40, 0xA9ULL << 40, 0x69ULL << 40, 0xE9ULL << 40, 
-        0x19ULL << 40, 0x99ULL << 40, 0x59ULL << 40, 0xD9ULL << 40, 0x39ULL << 40, 0xB9ULL << 40, 0x79ULL << 40, 0xF9ULL << 40, 
-        0x05ULL << 40, 0x85ULL << 40, 0x45ULL << 40, 0xC5ULL << 40, 0x25ULL << 40, 0xA5ULL << 40, 0x65ULL << 40, 0xE5ULL << 40, 
-        0x15ULL << 40, 0x95ULL << 40, 0x55ULL << 40, 0xD5ULL << 40, 0x35ULL << 40, 0xB5ULL << 40, 0x75ULL << 40, 0xF5ULL << 40, 
-        0x0DULL << 40, 0x8DULL << 40, 0x4DULL << 40, 0xCDULL << 40, 0x2DULL << 40, 0xADULL << 40, 0x6DULL << 40, 0xEDULL << 40, 
-        0x1DULL << 40, 0x9DULL << 40, 0x5DULL << 40, 0xDDULL << 40, 0x3DULL << 40, 0xBDULL << 40, 0x7DULL << 40, 0xFDULL << 40, 
-        0x03ULL << 40, 0x83ULL << 40, 0x43ULL << 40, 0xC3ULL << 40, 0x23ULL << 40, 0xA3ULL << 40, 0x63ULL << 40, 0xE3ULL << 40, 
-        0x13ULL << 40, 0x93ULL << 40, 0x53ULL << 40, 0xD3ULL << 40, 0x33ULL << 40, 0xB3ULL << 40, 0x73ULL << 40, 0xF3ULL << 40, 
-        0x0BULL << 40, 0x8BULL << 40, 0x4BULL << 40, 0xCBULL << 40, 0x2BULL << 40, 0xABULL << 40, 0x6BULL << 40, 0xEBULL << 40, 
-        0x1BULL << 40, 0x9BULL << 40, 0x5BULL << 40, 0xDBULL << 40, 0x3BULL << 40, 0xBBULL << 40, 0x7BULL << 40, 0xFBULL << 40, 
-        0x07ULL << 40, 0x87ULL << 40, 0x47ULL << 40, 0xC7ULL << 40, 0x27ULL << 40, 0xA7ULL << 40, 0x67ULL << 40, 0xE7ULL << 40, 
-        0x17ULL << 40, 0x97ULL << 40, 0x57ULL << 40, 0xD7ULL << 40, 0x37ULL << 40, 0xB7ULL << 40, 0x77ULL << 40, 0xF7ULL << 40, 
-        0x0FULL << 40, 0x8FULL << 40, 0x4FULL << 40, 0xCFULL << 40, 0x2FULL << 40, 0xAFULL << 40, 0x6FULL << 40, 0xEFULL << 40, 
-        0x1FULL << 40, 0x9FULL << 40, 0x5FULL << 40, 0xDFULL << 40, 0x3FULL << 40, 0xBFULL << 40, 0x7FULL << 40, 0xFFULL << 40, 
-    },{
-        0x00ULL << 48, 0x80ULL << 48, 0x40ULL << 48, 0xC0ULL << 48, 0x20ULL << 48, 0xA0ULL << 48, 0x60ULL << 48, 0xE0ULL << 48, 
-        0x10ULL << 48, 0x90ULL << 48, 0x50ULL << 48, 0xD0ULL << 48, 0x30ULL << 48, 0xB0ULL << 48, 0x70ULL << 48, 0xF0ULL << 48, 
-        0x08ULL << 48, 0x88ULL << 48, 0x48ULL << 48, 0xC8ULL << 48, 0x28ULL << 48, 0xA8ULL << 48, 0x68ULL << 48, 0xE8ULL << 48, 
-        0x18ULL << 48, 0x98ULL << 48, 0x58ULL << 48, 0xD8ULL << 48, 0x38ULL << 48, 0xB8ULL << 48, 0x78ULL << 48, 0xF8ULL << 48, 
-        0x04ULL << 48, 0x84ULL << 48, 0x44ULL << 48, 0xC4ULL << 48, 0x24ULL << 48, 0xA4ULL << 48, 0x64ULL << 48, 0xE4ULL << 48, 
-        0x14ULL << 48, 0x94ULL << 48, 0x54ULL << 48, 0xD4ULL << 48, 0x34ULL << 48, 0xB4ULL << 48, 0x74ULL << 48, 0xF4ULL << 48, 
-        0x0CULL << 48, 0x8CULL << 48, 0x4CULL << 48, 0xCCULL << 48, 0x2CULL << 48, 0xACULL << 48, 0x6CULL << 48, 0xECULL << 48, 
-        0x1CULL << 48, 0x9CULL << 48, 0x5CULL << 48, 0xDCULL << 48, 0x3CULL << 48, 0xBCULL << 48, 0x7CULL << 48, 0xFCULL << 48, 
-        0x02ULL << 48, 0x82ULL << 48, 0x42ULL << 48, 0xC2ULL << 48, 0x22ULL << 48, 0xA2ULL << 48, 0x62ULL << 48, 0xE2ULL << 48, 
-        0x12ULL << 48, 0x92ULL << 48, 0x52ULL << 48, 0xD2ULL << 48, 0x32ULL << 48, 0xB2ULL << 48, 0x72ULL << 48, 0xF2ULL << 48, 
-        0x0AULL << 48, 0x8AULL << 48, 0x4AULL << 48, 0xCAULL << 48, 0x2AULL << 48, 0xAAULL << 48, 0x6AULL << 48, 0xEAULL << 48, 
-        0x1AULL << 48, 0x9AULL << 48, 0x5AULL << 48, 0xDAULL << 48, 0x3AULL << 48, 0xBAULL << 48, 0x7AULL << 48, 0xFAULL << 48, 
-        0x06ULL << 48, 0x86ULL << 48, 0x46ULL << 48, 0xC6ULL << 48, 0x26ULL << 48, 0xA6ULL << 48, 0x66ULL << 48, 0xE6ULL << 48, 
-        0x16ULL << 48, 0x96ULL << 48, 0x56ULL << 48, 0xD6ULL << 48, 0x36ULL << 48, 0xB6ULL << 48, 0x76ULL << 48, 0xF6ULL << 48, 
-        0x0EULL << 48, 0x8EULL << 48, 0x4EULL << 48, 0xCEULL << 48, 0x2EULL << 48, 0xAEULL << 48, 0x6EULL << 48, 0xEEULL << 48, 
-        0x1EULL << 48, 0x9EULL << 48, 0x5EULL << 48, 0xDEULL << 48, 0x3EULL << 48, 0xBEULL << 48, 0x7EULL << 48, 0xFEULL << 48, 
-        0x01ULL << 48, 0x81ULL << 48, 0x41ULL << 48, 0xC1ULL << 48, 0x21ULL << 48, 0xA1ULL << 48, 0x61ULL << 48, 0xE1ULL << 48, 
-        0x11ULL << 48, 0x91ULL << 48, 0x51ULL << 48, 0xD1ULL << 48, 0x31ULL << 48, 0xB1ULL << 48, 0x71ULL << 48, 0xF1ULL << 48, 
-        0x09ULL << 48, 0x89ULL << 48, 0x49ULL << 48, 0xC9ULL << 48, 0x29ULL << 48, 0xA9ULL << 48, 0x69ULL << 48, 0xE9ULL << 48, 
-        0x19ULL << 48, 0x99ULL << 48, 0x59ULL << 48, 0xD9ULL << 48, 0x39ULL << 48, 0xB9ULL << 48, 0x79ULL << 48, 0xF9ULL << 48, 
-        0x05ULL << 48, 0x85ULL << 48, 0x45ULL << 48, 0xC5ULL << 48, 0x25ULL << 48, 0xA5ULL << 48, 0x65ULL << 48, 0xE5ULL << 48, 
-        0x15ULL << 48, 0x95ULL << 48, 0x55ULL << 48, 0xD5ULL << 48, 0x35ULL << 48, 0xB5ULL << 48, 0x75ULL << 48, 0xF5ULL << 48, 
-        0x0DULL << 48, 0x8DULL << 48, 0x4DULL << 48, 0xCDULL << 48, 0x2DULL << 48, 0xADULL << 48, 0x6DULL << 48, 0xEDULL << 48, 
-        0x1DULL << 48, 0x9DULL << 48, 0x5DULL << 48, 0xDDULL << 48, 0x3DULL << 48, 0xBDULL << 48, 0x7DULL << 48, 0xFDULL << 48, 
-        0x03ULL << 48, 0x83ULL << 48, 0x43ULL << 48, 0xC3ULL << 48, 0x23ULL << 48, 0xA3ULL << 48, 0x63ULL << 48, 0xE3ULL << 48, 
-        0x13ULL << 48, 0x93ULL << 48, 0x53ULL << 48, 0xD3ULL << 48, 0x33ULL << 48, 0xB3ULL << 48, 0x73ULL << 48, 0xF3ULL << 48, 
-        0x0BULL << 48, 0x8BULL << 48, 0x4BULL << 48, 0xCBULL << 48, 0x2BULL << 48, 0xABULL << 48, 0x6BULL << 48, 0xEBULL << 48, 
-        0x1BULL << 48, 0x9BULL << 48, 0x5BULL << 48, 0xDBULL << 48, 0x3BULL << 48, 0xBBULL << 48, 0x7BULL << 48, 0xFBULL << 48, 
-        0x07ULL << 48, 0x87ULL << 48, 0x47ULL << 48, 0xC7ULL << 48, 0x27ULL << 48, 0xA7ULL << 48, 0x67ULL << 48, 0xE7ULL << 48, 
-        0x17ULL << 48, 0x97ULL << 48, 0x57ULL << 48, 0xD7ULL << 48, 0x37ULL << 48, 0xB7ULL << 48, 0x77ULL << 48, 0xF7ULL << 48, 
-        0x0FULL << 48, 0x8FULL << 48, 0x4FULL << 48, 0xCFULL << 48, 0x2FULL << 48, 0xAFULL << 48, 0x6FULL << 48, 0xEFULL << 48, 
-        0x1FULL << 48, 0x9FULL << 48, 0x5FULL << 48, 0xDFULL << 48, 0x3FULL << 48, 0xBFULL << 48, 0x7FULL << 48, 0xFFULL << 48, 
-    },{
-        0x00ULL << 56, 0x80ULL << 56, 0x40ULL << 56, 0xC0ULL << 56, 0x20ULL << 56, 0xA0ULL << 56, 0x60ULL << 56, 0xE0ULL << 56, 
-        0x10ULL << 56, 0x90ULL << 56, 0x50ULL << 56, 0xD0ULL << 56, 0x30ULL << 56, 0xB0ULL << 56, 0x70ULL << 56, 0xF0ULL << 56, 
-        0x08ULL << 56, 0x88ULL << 56, 0x48ULL << 56, 0xC8ULL << 56, 0x28ULL << 56, 0xA8ULL << 56, 0x68ULL << 56, 0xE8ULL << 56, 
-        0x18ULL << 56, 0x98ULL << 56, 0x58ULL << 56, 0xD8ULL << 56, 0x38ULL << 56, 0xB8ULL << 56, 0x78ULL << 56, 0xF8ULL << 56, 
-        0x04ULL << 56, 0x84ULL << 56, 0x44ULL << 56, 0xC4ULL << 56, 0x24ULL << 56, 0xA4ULL << 56, 0x64ULL << 56, 0xE4ULL << 56, 
-        0x14ULL << 56, 0x94ULL << 56, 0x54ULL << 56, 0xD4ULL << 56, 0x34ULL << 56, 0xB4ULL << 56, 0x74ULL << 56, 0xF4ULL << 56, 
-        0x0CULL << 56, 0x8CULL << 56, 0x4CULL << 56, 0xCCULL << 56, 0x2CULL << 56, 0xACULL << 56, 0x6CULL << 56, 0xECULL << 56, 
-        0x1CULL << 56, 0x9CULL << 56, 0x5CULL << 56, 0xDCULL << 56, 0x3CULL << 56, 0xBCULL << 56, 0x7CULL << 56, 0xFCULL << 56, 
-        0x02ULL << 56, 0x82ULL << 56, 0x42ULL << 56, 0xC2ULL << 56, 0x22ULL << 56, 0xA2ULL << 56, 0x62ULL << 56, 0xE2ULL << 56, 
-        0x12ULL << 56, 0x92ULL << 56, 0x52ULL << 56, 0xD2ULL << 56, 0x32ULL << 56, 0xB2ULL << 56, 0x72ULL << 56, 0xF2ULL << 56, 
-        0x0AULL << 56, 0x8AULL << 56, 0x4AULL << 56, 0xCAULL << 56, 0x2AULL << 56, 0xAAULL << 56, 0x6AULL << 56, 0xEAULL << 56, 
-        0x1AULL << 56, 0x9AULL << 56, 0x5AULL << 56, 0xDAULL << 56, 0x3AULL << 56, 0xBAULL << 56, 0x7AULL << 56, 0xFAULL << 56, 
-        0x06ULL << 56, 0x86ULL << 56, 0x46ULL << 56, 0xC6ULL << 56, 0x26ULL << 56, 0xA6ULL << 56, 0x66ULL << 56, 0xE6ULL << 56, 
-        0x16ULL << 56, 0x96ULL << 56, 0x56ULL << 56, 0xD6ULL << 56, 0x36ULL << 56, 0xB6ULL << 56, 0x76ULL << 56, 0xF6ULL << 56, 
-        0x0EULL << 56, 0x8EULL << 56, 0x4EULL << 56, 0xCEULL << 56, 0x2EULL << 56, 0xAEULL << 56, 0x6EULL << 56, 0xEEULL << 56, 
-        0x1EULL << 56, 0x9EULL << 56, 0x5EULL << 56, 0xDEULL << 56, 0x3EULL << 56, 0xBEULL << 56, 0x7EULL << 56, 0xFEULL << 56, 
-        0x01ULL << 56, 0x81ULL << 56, 0x41ULL << 56, 0xC1ULL << 56, 0x21ULL << 56, 0xA1ULL << 56, 0x61ULL << 56, 0xE1ULL << 56, 
-        0x11ULL << 56, 0x91ULL << 56, 0x51ULL << 56, 0xD1ULL << 56, 0x31ULL << 56, 0xB1ULL << 56, 0x71ULL << 56, 0xF1ULL << 56, 
-        0x09ULL << 56, 0x89ULL << 56, 0x49ULL << 56, 0xC9ULL << 56, 0x29ULL << 56, 0xA9ULL << 56, 0x69ULL << 56, 0xE9ULL << 56, 
-        0x19ULL << 56, 0x99ULL << 56, 0x59ULL << 56, 0xD9ULL << 56, 0x39ULL << 56, 0xB9ULL << 56, 0x79ULL << 56, 0xF9ULL << 56, 
-        0x05ULL << 56, 0x85ULL << 56, 0x45ULL << 56, 0xC5ULL << 56, 0x25ULL << 56, 0xA5ULL << 56, 0x65ULL << 56, 0xE5ULL << 56, 
-        0x15ULL << 56, 0x95ULL << 56, 0x55ULL << 56, 0xD5ULL << 56, 0x35ULL << 56, 0xB5ULL << 56, 0x75ULL << 56, 0xF5ULL << 56, 
-        0x0DULL << 56, 0x8DULL << 56, 0x4DULL << 56, 0xCDULL << 56, 0x2DULL << 56, 0xADULL << 56, 0x6DULL << 56, 0xEDULL << 56, 
-        0x1DULL << 56, 0x9DULL << 56, 0x5DULL << 56, 0xDDULL << 56, 0x3DULL << 56, 0xBDULL << 56, 0x7DULL << 56, 0xFDULL << 56, 
-        0x03ULL << 56, 0x83ULL << 56, 0x43ULL << 56, 0xC3ULL << 56, 0x23ULL << 56, 0xA3ULL << 56, 0x63ULL << 56, 0xE3ULL << 56, 
-        0x13ULL << 56, 0x93ULL << 56, 0x53ULL << 56, 0xD3ULL << 56, 0x33ULL << 56, 0xB3ULL << 56, 0x73ULL << 56, 0xF3ULL << 56, 
-        0x0BULL << 56, 0x8BULL << 56, 0x4BULL << 56, 0xCBULL << 56, 0x2BULL << 56, 0xABULL << 56, 0x6BULL << 56, 0xEBULL << 56, 
-        0x1BULL << 56, 0x9BULL << 56, 0x5BULL << 56, 0xDBULL << 56, 0x3BULL << 56, 0xBBULL << 56, 0x7BULL << 56, 0xFBULL << 56, 
-        0x07ULL << 56, 0x87ULL << 56, 0x47ULL << 56, 0xC7ULL << 56, 0x27ULL << 56, 0xA7ULL << 56, 0x67ULL << 56, 0xE7ULL << 56, 
-        0x17ULL << 56, 0x97ULL << 56, 0x57ULL << 56, 0xD7ULL << 56, 0x37ULL << 56, 0xB7ULL << 56, 0x77ULL << 56, 0xF7ULL << 56, 
-        0x0FULL << 56, 0x8FULL << 56, 0x4FULL << 56, 0xCFULL << 56, 0x2FULL << 56, 0xAFULL << 56, 0x6FULL << 56, 0xEFULL << 56, 
-        0x1FULL << 56, 0x9FULL << 56, 0x5FULL << 56, 0xDFULL << 56, 0x3FULL << 56, 0xBFULL << 56, 0x7FULL << 56, 0xFFULL << 56, 
-    }
-};
-
-const U8 PopCount16[1 << 16] = 
-{
-     0,  1,  1,  2,  1,  2,  2,  3,  1,  2,  2,  3,  2,  3,  3,  4,  1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     5,  6,  6,  7,  6,  7,  7,  8,  6,  7,  7,  8,  7,  8,  8,  9,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     6,  7,  7,  8,  7,  8,  8,  9,  7,  8,  8,  9,  8,  9,  9, 10,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     7,  8,  8,  9,  8,  9,  9, 10,  8,  9,  9, 10,  9, 10, 10, 11,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     8,  9,  9, 10,  9, 10, 10, 11,  9, 10, 10, 11, 10, 11, 11, 12,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13,  9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-     9, 10, 10, 11, 10, 11, 11, 12, 10, 11, 11, 12, 11, 12, 12, 13, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 
-    10, 11, 11, 12, 11, 12, 12, 13, 11, 12, 12, 13, 12, 13, 13, 14, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 11, 12, 12, 13, 12, 13, 13, 14, 12, 13, 13, 14, 13, 14, 14, 15, 12, 13, 13, 14, 13, 14, 14, 15, 13, 14, 14, 15, 14, 15, 15, 16, 
-};
@@ -0,0 +1,122 @@
+/**
+ * @file TimeMan.c
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Implements search time management. 
+ */
+
+#include "TimeMan.h" 
+
+#include <time.h> 
+
+/**
+ * Percent of the soft limit to use based on how many iterations in a row 
+ * returned the same best move. 
+ */
+static const int StabilityScale[] = 
+{
+    140, 110, 90, 80, 70 
+};
+
+/**
+ * Largest score drop (in centipawns) that still increases the time used. 
+ */
+#define MaxScoreDrop 100 
+
+TimePoint GetTimeMs(void) 
+{
+    struct timespec ts; 
+    clock_gettime(CLOCK_MONOTONIC, &ts); 
+    return (TimePoint) ts.tv_sec * 1000 + (TimePoint) ts.tv_nsec / 1000000; 
+}
+
+/**
+ * Resets data that is shared by all time controls. 
+ * 
+ * @param tm The time manager 
+ */
+static void ResetTimeManager(TimeManager* tm) 
+{
+    tm->StartAt = GetTimeMs(); 
+    tm->LastBest = NoMove; 
+    tm->LastEval = 0; 
+    tm->Stability = 0; 
+}
+
+void InitFixedTime(TimeManager* tm, int moveTimeMs) 
+{
+    ResetTimeManager(tm); 
+
+    // the whole move time is used, no matter how stable the search is 
+    tm->SoftMs = NoTimeLimit; 
+    tm->HardMs = moveTimeMs >= 0 ? moveTimeMs : NoTimeLimit; 
+}
+
+void InitClockTime(TimeManager* tm, int timeLeftMs, int incMs, int movesToGo) 
+{
+    ResetTimeManager(tm); 
+
+    int mtg = movesToGo > 0 ? movesToGo : DefaultMovesToGo; 
+    if (mtg > DefaultMovesToGo) mtg = DefaultMovesToGo; 
+
+    int available = timeLeftMs - MoveOverheadMs; 
+    if (available < 1) available = 1; 
+
+    int soft = available / mtg + incMs * 3 / 4; 
+
+    // never risk most of the clock on a single move unless it is the last one 
+    int maxMs = mtg == 1 ? available * 9 / 10 : available / 2; 
+    int hard = soft * 4; 
+    if (hard > maxMs) hard = maxMs; 
+    if (hard < 1) hard = 1; 
+    if (soft > hard) soft = hard; 
+    if (soft < 1) soft = 1; 
+
+    tm->SoftMs = soft; 
+    tm->HardMs = hard; 
+}
+
+int GetElapsedMs(const TimeManager* tm) 
+{
+    return (int) (GetTimeMs() - tm->StartAt); 
+}
+
+bool IsHardLimitReached(const TimeManager* tm) 
+{
+    return tm->HardMs >= 0 && GetElapsedMs(tm) >= tm->HardMs; 
+}
+
+bool ShouldStopIteration(TimeManager* tm, Move best, int eval) 
+{
+    int scale = 100; 
+
+    if (tm->LastBest != NoMove) 
+    {
+        // a best move that keeps changing needs more time to settle 
+        if (best == tm->LastBest) 
+        {
+            if (tm->Stability < 4) tm->Stability++; 
+        }
+        else 
+        {
+            tm->Stability = 0; 
+        }
+        scale = StabilityScale[tm->Stability]; 
+
+        // a falling score means the previous best move was refuted 
+        int drop = tm->LastEval - eval; 
+        if (drop > MaxScoreDrop) drop = MaxScoreDrop; 
+        if (drop > 0) scale = scale * (100 + drop) / 100; 
+    }
+
+    tm->LastBest = best; 
+    tm->LastEval = eval; 
+
+    if (IsHardLimitReached(tm)) return true; 
+    if (tm->SoftMs < 0) return false; 
+
+    return (long long) GetElapsedMs(tm) * 100 >= (long long) tm->SoftMs * scale; 
+}
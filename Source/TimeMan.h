@@ -0,0 +1,108 @@
+/**
+ * @file TimeMan.h
+ * @author Nicholas Hamilton 
+ * @date 2026-10-17
+ * 
+ * Copyright (c) 2023 Nicholas Hamilton
+ * 
+ * Defines search time management. 
+ * 
+ * All times are measured with a monotonic wall clock, so they are not 
+ * affected by the number of search threads or by the process being 
+ * descheduled. 
+ */
+
+#pragma once 
+
+#include <stdbool.h> 
+
+#include "Move.h" 
+#include "Types.h" 
+
+/**
+ * No time limit. 
+ */
+#define NoTimeLimit (-1) 
+
+/**
+ * Time reserved for communication with the GUI on every move. 
+ */
+#define MoveOverheadMs 30 
+
+/**
+ * Number of moves to plan for when the GUI does not send `movestogo`. 
+ */
+#define DefaultMovesToGo 40 
+
+/**
+ * Milliseconds on a monotonic clock with an unspecified origin. 
+ */
+typedef U64 TimePoint; 
+
+typedef struct TimeManager TimeManager; 
+
+/**
+ * Time limits for a single search. 
+ * 
+ * The soft limit is checked between iterations and scaled by how stable 
+ * the search is. The hard limit is checked during search and is never 
+ * exceeded. 
+ */
+struct TimeManager 
+{
+    TimePoint StartAt; 
+    int SoftMs; 
+    int HardMs; 
+
+    Move LastBest; 
+    int LastEval; 
+    int Stability; 
+};
+
+/**
+ * @return Current time in milliseconds 
+ */
+TimePoint GetTimeMs(void); 
+
+/**
+ * Starts timing a search with a fixed time per move (or no limit). 
+ * 
+ * @param tm The time manager 
+ * @param moveTimeMs Time for this move (or NoTimeLimit) 
+ */
+void InitFixedTime(TimeManager* tm, int moveTimeMs); 
+
+/**
+ * Starts timing a search from the remaining clock time. 
+ * 
+ * @param tm The time manager 
+ * @param timeLeftMs Time left on the clock 
+ * @param incMs Increment per move 
+ * @param movesToGo Moves until next time control (or 0 if unknown) 
+ */
+void InitClockTime(TimeManager* tm, int timeLeftMs, int incMs, int movesToGo); 
+
+/**
+ * @param tm The time manager 
+ * @return Milliseconds since the search started 
+ */
+int GetElapsedMs(const TimeManager* tm); 
+
+/**
+ * Checks if the search must stop immediately. 
+ * 
+ * @param tm The time manager 
+ * @return True if the hard limit has been reached 
+ */
+bool IsHardLimitReached(const TimeManager* tm); 
+
+/**
+ * Checks if another iteration should be started. Must be called after 
+ * each completed iteration of the main search thread. 
+ * 
+ * @param tm The time manager 
+ * @param best Best move of the iteration 
+ * @param eval Evaluation of the iteration 
+ * @return True if the search should stop 
+ */
+bool ShouldStopIteration(TimeManager* tm, Move best, int eval); 
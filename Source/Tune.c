@@ -103,7 +103,10 @@ void* EThread(void* data)
         FenState* fen = ElemAt(States, i);  
         double result = fen->Result; 
 
-        double add = result - Sigmoid(Evaluate(&fen->Board, 0, fen->NumMoves, fen->Draw, 0)); 
+        // weights changed since the position was loaded 
+        ComputeEvalState(&fen->Board, &fen->Board.Eval); 
+
+        double add = result - Sigmoid(Evaluate(&fen->Board, NULL, NULL, 0, fen->NumMoves, fen->Draw, 0)); 
         ThreadErrors[offset] += add * add; 
     }
 
@@ -186,6 +189,8 @@ int main(int argc, char** argv)
         return 1; 
     }
 
+    InitSliderTables(); 
+
     NWeights = GetNumEvalParams(); 
     Weights = calloc(NWeights, sizeof(int)); 
     Names = calloc(NWeights, ParamNameLength); 
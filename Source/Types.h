@@ -15,9 +15,9 @@
 typedef uint64_t U64; 
 typedef uint32_t U32; 
 typedef uint16_t U16; 
-typedef uint64_t U8; 
+typedef uint8_t U8; 
 
 typedef int64_t S64; 
 typedef int32_t S32; 
 typedef int16_t S16; 
-typedef int64_t S8; 
+typedef int8_t S8; 
@@ -22,6 +22,88 @@ Zobrist SquarePieceHashValues[NumSquares][NumPieces + 1];
 Zobrist CastleHashValues[CastleAll + 1]; 
 Zobrist EnPassantHashValues[8 + 1]; 
 Zobrist ColorHashValue; 
+Zobrist CuckooHashValues[CuckooSize]; 
+Move CuckooMoves[CuckooSize]; 
+
+/**
+ * Checks if a piece can move between two squares on an empty board. 
+ * 
+ * @param type Piece type (not a pawn) 
+ * @param a First square 
+ * @param b Second square 
+ * @return True if the piece can move from one square to the other 
+ */
+static bool CanMoveBetween(PieceType type, Square a, Square b) 
+{
+    int dir = PinIndex[a][b]; 
+    bool rook = dir <= CheckDirectionRookEnd; 
+    bool bishop = dir > CheckDirectionRookEnd && dir < NumCheckDirections; 
+
+    switch (type) 
+    {
+        case PieceN: return (MovesN[a] & Bits[b]) != 0; 
+        case PieceB: return bishop; 
+        case PieceR: return rook; 
+        case PieceQ: return rook || bishop; 
+        case PieceK: return (MovesK[a] & Bits[b]) != 0; 
+        default: return false; 
+    }
+}
+
+/**
+ * Fills the cuckoo table. Must be called after the other hash values 
+ * are generated. 
+ */
+static void InitCuckoo(void) 
+{
+    for (int i = 0; i < CuckooSize; i++) 
+    {
+        CuckooHashValues[i] = 0; 
+        CuckooMoves[i] = NoMove; 
+    }
+
+    int count = 0; 
+    for (Piece pc = 0; pc < NumPieces; pc++) 
+    {
+        if (TypeOfPiece(pc) == PieceP) continue; 
+
+        for (Square a = 0; a < NumSquares; a++) 
+        {
+            for (Square b = a + 1; b < NumSquares; b++) 
+            {
+                if (!CanMoveBetween(TypeOfPiece(pc), a, b)) continue; 
+
+                Zobrist hash = SquarePieceHashValues[a][pc] ^ SquarePieceHashValues[b][pc] ^ ColorHashValue; 
+                Move mv = MakeMove(a, b, pc, NoPiece, false); 
+
+                // move entries between their two slots until one is free 
+                int slot = CuckooSlot1(hash); 
+                while (true) 
+                {
+                    Zobrist tmpHash = CuckooHashValues[slot]; 
+                    Move tmpMv = CuckooMoves[slot]; 
+                    CuckooHashValues[slot] = hash; 
+                    CuckooMoves[slot] = mv; 
+                    hash = tmpHash; 
+                    mv = tmpMv; 
+
+                    if (!hash) break; 
+                    slot = (slot == CuckooSlot1(hash)) ? CuckooSlot2(hash) : CuckooSlot1(hash); 
+                }
+                count++; 
+            }
+        }
+    }
+
+#ifdef VALIDATION 
+    if (count != 3668) 
+    {
+        printf("info string ERROR cuckoo table has %d moves instead of 3668\n", count); 
+    }
+#else 
+    (void) count; 
+#endif 
+}
 
 void InitHash(void) 
 {
@@ -61,6 +143,8 @@ void InitHash(void)
 
     ColorHashValue = NextU64(&r); 
 
+    InitCuckoo(); 
+
     IsHashInit = true; 
 }
 
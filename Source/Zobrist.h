@@ -15,12 +15,18 @@
 #include <stdio.h> 
 
 #include "Castle.h" 
+#include "Move.h" 
 #include "Piece.h"
 #include "Square.h"
 #include "Types.h" 
 
 #define ZobristSeed 0xF72B927A3EED2837ULL
 
+/**
+ * Number of slots in the cuckoo table of reversible moves. 
+ */
+#define CuckooSize 8192 
+
 typedef U64 Zobrist; 
 
 extern Zobrist SquarePieceHashValues[NumSquares][NumPieces + 1]; 
@@ -28,6 +34,14 @@ extern Zobrist CastleHashValues[CastleAll + 1];
 extern Zobrist EnPassantHashValues[8 + 1]; 
 extern Zobrist ColorHashValue; 
 
+/**
+ * Hash changes of all reversible moves (without pawns) on an empty board, 
+ * including the side to move. Each key is in one of two slots, so a hash 
+ * difference can be looked up in constant time. 
+ */
+extern Zobrist CuckooHashValues[CuckooSize]; 
+extern Move CuckooMoves[CuckooSize]; 
+
 /**
  * Must be called once before using hashing. 
  */
@@ -43,6 +57,45 @@ static inline Zobrist HashSquarePiece(Square sq, Piece pc)
     return SquarePieceHashValues[sq][pc]; 
 }
 
+/**
+ * @param sq Square a piece is moving to or from 
+ * @param pc The piece (can be `NoPiece`) 
+ * @return Hash to XOR with the pawn hash, which only includes pawns 
+ */
+static inline Zobrist HashPawnSquare(Square sq, Piece pc) 
+{
+    return (pc == PieceWP || pc == PieceBP) * SquarePieceHashValues[sq][pc]; 
+}
+
+/**
+ * The square hashes are reused with the piece count in place of the square, 
+ * so each piece type has a different hash for every count. 
+ * 
+ * @param pc The piece (can be `NoPiece`) 
+ * @param count Number of pieces of that type, including the piece 
+ * @return Hash to XOR with the material hash when the piece is added or removed 
+ */
+static inline Zobrist HashMaterial(Piece pc, int count) 
+{
+    return SquarePieceHashValues[(count - 1) & 63][pc]; 
+}
+
+/**
+ * @param counts Number of pieces of each type 
+ * @return Material hash of the piece counts 
+ */
+static inline Zobrist HashMaterialCounts(const int* counts) 
+{
+    Zobrist hash = 0; 
+
+    for (Piece pc = 0; pc < NumPieces; pc++) 
+    {
+        for (int i = 1; i <= counts[pc]; i++) hash ^= HashMaterial(pc, i); 
+    }
+
+    return hash; 
+}
+
 /**
  * @param cf Castle flags 
  * @return Hash to XOR with
@@ -69,6 +122,24 @@ static inline Zobrist HashColor(void)
     return ColorHashValue; 
 } 
 
+/**
+ * @param hash Hash change of a move 
+ * @return First cuckoo table slot for the move 
+ */
+static inline int CuckooSlot1(Zobrist hash) 
+{
+    return (int) (hash & (CuckooSize - 1)); 
+}
+
+/**
+ * @param hash Hash change of a move 
+ * @return Second cuckoo table slot for the move 
+ */
+static inline int CuckooSlot2(Zobrist hash) 
+{
+    return (int) ((hash >> 16) & (CuckooSize - 1)); 
+}
+
 /**
  * Print hash to stdout. 
  * 